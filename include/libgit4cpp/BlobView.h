@@ -0,0 +1,82 @@
+/**
+ * \file   BlobView.h
+ * \date   Created on October 16, 2026
+ * \brief  Declaration of the BlobView class.
+ *
+ * \copyright Copyright 2026 Deutsches Elektronen-Synchrotron (DESY), Hamburg
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation, either version 2.1 of the license, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#ifndef LIBGIT4CPP_BLOBVIEW_H_
+#define LIBGIT4CPP_BLOBVIEW_H_
+
+#include <cstddef>
+#include <string_view>
+
+#include <git2.h>
+
+#include "libgit4cpp/types.h"
+
+namespace git {
+
+/**
+ * Read-only access to the content of a file stored in the object database.
+ *
+ * A BlobView owns the libgit2 blob object; content() returns a view of the data held by
+ * libgit2 without copying it:
+ *
+ * \code{.cpp}
+ * auto blob = repo.read_blob("HEAD~3", "sequences/pump/step_1.lua");
+ * std::string_view script = blob.content();
+ * \endcode
+ *
+ * The view returned by content() is valid as long as the BlobView exists. A BlobView
+ * must not outlive the Repository it was obtained from.
+ */
+class BlobView
+{
+public:
+    /**
+     * Construct a BlobView by taking the ownership of a git_blob unique pointer.
+     * \exception Error is thrown if the given pointer is null.
+     */
+    explicit BlobView(LibGitBlob&& blob);
+
+    /// Return the content of the blob (not null-terminated).
+    std::string_view content() const noexcept;
+
+    /// Return the size of the content in bytes.
+    std::size_t size() const noexcept;
+
+    /// Return the ID of the blob.
+    const git_oid& id() const noexcept;
+
+    /// Determine if the content looks like binary data.
+    bool is_binary() const noexcept;
+
+    /// Return a non-owning pointer to the underlying git blob object.
+    git_blob* get() const noexcept { return blob_.get(); }
+
+private:
+    LibGitBlob blob_{ nullptr, git_blob_free };
+};
+
+} // namespace git
+
+#endif
+
+// vi:ts=4:sw=4:sts=4:et
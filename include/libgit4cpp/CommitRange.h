@@ -0,0 +1,236 @@
+/**
+ * \file   CommitRange.h
+ * \date   Created on October 16, 2026
+ * \brief  Declaration of the CommitRange class.
+ *
+ * \copyright Copyright 2026 Deutsches Elektronen-Synchrotron (DESY), Hamburg
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation, either version 2.1 of the license, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#ifndef LIBGIT4CPP_COMMITRANGE_H_
+#define LIBGIT4CPP_COMMITRANGE_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <git2.h>
+
+#include "libgit4cpp/types.h"
+
+namespace git {
+
+/// Selection and order of the commits in a CommitRange.
+struct CommitRangeOptions
+{
+    /**
+     * Revisions whose history is walked (e.g. "HEAD", "main", "v1.0", a commit ID).
+     * A revision range like "v1.0..main" pushes the right and hides the left side.
+     */
+    std::vector<std::string> push = { "HEAD" };
+    /// Revisions whose history is excluded from the walk.
+    std::vector<std::string> hide;
+    /// Show parents only after all of their children.
+    bool topological = false;
+    /// Sort by commit time, newest first.
+    bool time = false;
+    /// Reverse the order (e.g. oldest first when combined with time).
+    bool reverse = false;
+    /// Follow only the first parent of merge commits.
+    bool first_parent_only = false;
+};
+
+/// Owning summary of a commit, e.g. for a history list.
+struct CommitInfo
+{
+    /// Commit ID as a hexadecimal string.
+    std::string id;
+    /// First paragraph of the commit message.
+    std::string summary;
+    /// Full commit message.
+    std::string message;
+    /// Name of the author.
+    std::string author_name;
+    /// Email address of the author.
+    std::string author_email;
+    /// Commit time in seconds since the Unix epoch.
+    std::int64_t time = 0;
+};
+
+/**
+ * Non-owning view of a commit in a CommitRange.
+ *
+ * The commit object is only looked up when one of its properties apart from the ID is
+ * accessed. The returned string views are valid until the iterator it was obtained from
+ * is advanced.
+ */
+class CommitView
+{
+public:
+    /// Return the ID of the commit.
+    const git_oid& id() const noexcept { return id_; }
+
+    /// Return the ID of the commit as a hexadecimal string.
+    std::string id_string() const;
+
+    /// Return the full commit message.
+    std::string_view message() const;
+
+    /// Return the first paragraph of the commit message (with line breaks removed).
+    std::string_view summary() const;
+
+    /// Return the name of the author.
+    std::string_view author_name() const;
+
+    /// Return the email address of the author.
+    std::string_view author_email() const;
+
+    /// Return the commit time in seconds since the Unix epoch.
+    std::int64_t time() const;
+
+    /// Return the time zone offset of the commit time in minutes.
+    int time_offset() const;
+
+    /// Return the number of parents (0 for a root commit, 2 or more for a merge).
+    unsigned int parent_count() const;
+
+    /// Return a non-owning pointer to the underlying git commit object.
+    git_commit* get() const;
+
+    /// Convert the view into an owning CommitInfo.
+    CommitInfo to_commit_info() const;
+
+private:
+    friend class CommitRange;
+
+    git_repository* repo_{ nullptr };
+    git_oid id_{ };
+    mutable LibGitCommit commit_{ nullptr, git_commit_free };
+};
+
+/**
+ * A range over the commit history of a repository, backed by a libgit2 revision walker.
+ *
+ * The range is single-pass: Commit IDs are produced on demand while iterating, and the
+ * commit objects are only looked up when a property of the CommitView is accessed.
+ * Reading a page of messages is therefore linear in the number of commits visited:
+ *
+ * \code{.cpp}
+ * CommitRangeOptions opts;
+ * opts.time = true;
+ * std::size_t count = 0;
+ * for (const auto& commit : repo.commits(opts))
+ * {
+ *     std::cout << commit.id_string() << ' ' << commit.summary() << '\n';
+ *     if (++count == 50)
+ *         break;
+ * }
+ * \endcode
+ *
+ * A CommitRange must not outlive the Repository it was obtained from.
+ */
+class CommitRange
+{
+public:
+    /// Input iterator over the commits of a CommitRange yielding CommitView objects.
+    class const_iterator
+    {
+    public:
+        using iterator_category = std::input_iterator_tag;
+        using value_type = CommitView;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const CommitView*;
+        using reference = const CommitView&;
+
+        const_iterator() = default;
+
+        reference operator*() const { return *view_; }
+        pointer operator->() const { return view_; }
+
+        /// Advance to the next commit; string views of the previous commit are invalidated.
+        const_iterator& operator++()
+        {
+            view_ = range_->next();
+            return *this;
+        }
+
+        friend bool operator==(const const_iterator& a, const const_iterator& b)
+        {
+            return a.view_ == b.view_;
+        }
+
+        friend bool operator!=(const const_iterator& a, const const_iterator& b)
+        {
+            return a.view_ != b.view_;
+        }
+
+    private:
+        friend class CommitRange;
+
+        CommitRange* range_{ nullptr };
+        const CommitView* view_{ nullptr };
+
+        const_iterator(CommitRange* range, const CommitView* view)
+            : range_{ range }, view_{ view }
+        { }
+    };
+
+    using iterator = const_iterator;
+
+    /**
+     * Set up a revision walk over the given repository.
+     * \exception Error is thrown if a revision cannot be resolved.
+     */
+    CommitRange(git_repository* repo, const CommitRangeOptions& options);
+
+    CommitRange(const CommitRange&) = delete;
+    CommitRange& operator=(const CommitRange&) = delete;
+
+    /**
+     * Return an iterator to the next commit of the walk.
+     *
+     * The range is single-pass: Calling begin() again continues where the previous
+     * iteration stopped.
+     *
+     * \exception Error is thrown if the walk fails.
+     */
+    const_iterator begin();
+
+    /// Return an iterator marking the end of the walk.
+    const_iterator end() noexcept { return const_iterator{ this, nullptr }; }
+
+    /// Return a non-owning pointer to the underlying git revision walker.
+    git_revwalk* get() const noexcept { return walk_.get(); }
+
+private:
+    LibGitRevwalk walk_{ nullptr, git_revwalk_free };
+    CommitView view_;
+    bool started_{ false };
+    bool done_{ false };
+
+    /// Fetch the next commit ID into view_ and return a pointer to it (null at the end).
+    const CommitView* next();
+};
+
+} // namespace git
+
+#endif
+
+// vi:ts=4:sw=4:sts=4:et
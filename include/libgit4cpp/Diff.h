@@ -0,0 +1,221 @@
+/**
+ * \file   Diff.h
+ * \date   Created on October 16, 2026
+ * \brief  Declaration of the Diff class.
+ *
+ * \copyright Copyright 2026 Deutsches Elektronen-Synchrotron (DESY), Hamburg
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation, either version 2.1 of the license, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#ifndef LIBGIT4CPP_DIFF_H_
+#define LIBGIT4CPP_DIFF_H_
+
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <git2.h>
+
+#include "libgit4cpp/FileStatus.h"
+#include "libgit4cpp/types.h"
+
+namespace git {
+
+/// Options for calculating a Diff.
+struct DiffOptions
+{
+    /// Only compare these paths (wildcards allowed); compare everything if empty.
+    std::vector<std::string> pathspec;
+    /// Treat the pathspec entries as literal paths instead of patterns.
+    bool pathspec_literal = false;
+    /// Do not look into file contents to detect binary files (faster).
+    bool skip_binary_check = false;
+    /// Report untracked files (only relevant when the working directory is compared).
+    bool include_untracked = false;
+    /// Ignore all whitespace when comparing lines.
+    bool ignore_whitespace = false;
+    /// Number of unchanged lines shown around each hunk.
+    unsigned int context_lines = 3;
+};
+
+/**
+ * Non-owning view of one changed file in a Diff.
+ *
+ * The paths point into the Diff from which the view was obtained and are only valid as
+ * long as that Diff exists.
+ */
+struct DiffDelta
+{
+    /// Path of the file on the old side.
+    std::string_view old_path;
+    /// Path of the file on the new side.
+    std::string_view new_path;
+    /// Kind of change (new_file, modified, deleted, renamed, typechange, untracked, ...).
+    Change change = Change::unchanged;
+    /// Object ID on the old side (zero if the file does not exist there).
+    git_oid old_id{ };
+    /// Object ID on the new side (zero if the file does not exist or is not hashed yet).
+    git_oid new_id{ };
+    /// True if the file is known to be binary.
+    bool binary = false;
+};
+
+/// Position of a hunk within the old and new version of a file.
+struct DiffHunk
+{
+    /// Hunk header (e.g. "@@ -1,3 +1,4 @@\n").
+    std::string_view header;
+    int old_start = 0;
+    int old_lines = 0;
+    int new_start = 0;
+    int new_lines = 0;
+};
+
+/// One line of a hunk.
+struct DiffLine
+{
+    /// '+' for added, '-' for removed and ' ' for context lines (see git_diff_line_t).
+    char origin = ' ';
+    /// Content of the line including the line break (not null-terminated).
+    std::string_view content;
+    /// Line number in the old file or -1 for added lines.
+    int old_lineno = -1;
+    /// Line number in the new file or -1 for removed lines.
+    int new_lineno = -1;
+};
+
+/// Summary of the changes in a Diff.
+struct DiffStats
+{
+    std::size_t files_changed = 0;
+    std::size_t insertions = 0;
+    std::size_t deletions = 0;
+};
+
+/**
+ * The differences between two trees, the index or the working directory.
+ *
+ * A Diff only holds the list of changed files. File contents are loaded while the
+ * changes are streamed through for_each(), and no patch text is built in memory:
+ *
+ * \code{.cpp}
+ * auto diff = repo.diff("HEAD~1", "HEAD");
+ * diff.for_each(
+ *     [](const DiffDelta& delta) { std::cout << delta.new_path << '\n'; return true; },
+ *     nullptr,
+ *     [](const DiffDelta&, const DiffHunk&, const DiffLine& line) {
+ *         std::cout << line.origin << line.content;
+ *         return true;
+ *     });
+ * \endcode
+ *
+ * A Diff must not outlive the Repository it was obtained from.
+ */
+class Diff
+{
+public:
+    /// Called for each file; return false to stop.
+    using FileCallback = std::function<bool(const DiffDelta&)>;
+    /// Called for each hunk; return false to stop.
+    using HunkCallback = std::function<bool(const DiffDelta&, const DiffHunk&)>;
+    /// Called for each line; return false to stop.
+    using LineCallback = std::function<bool(const DiffDelta&, const DiffHunk&,
+        const DiffLine&)>;
+
+    /**
+     * Construct a Diff by taking the ownership of a git_diff unique pointer.
+     * \exception Error is thrown if the given pointer is null.
+     */
+    explicit Diff(LibGitDiff&& diff);
+
+    /**
+     * Compare two trees.
+     * \param repo     Repository the trees belong to
+     * \param old_tree Old side (null for an empty tree)
+     * \param new_tree New side (null for an empty tree)
+     * \param options  Options for the comparison
+     * \exception Error is thrown if the diff cannot be calculated.
+     */
+    static Diff tree_to_tree(git_repository* repo, git_tree* old_tree, git_tree* new_tree,
+        const DiffOptions& options);
+
+    /**
+     * Compare a tree with an index.
+     * \param old_tree Old side (null for an empty tree)
+     * \exception Error is thrown if the diff cannot be calculated.
+     */
+    static Diff tree_to_index(git_repository* repo, git_tree* old_tree, git_index* index,
+        const DiffOptions& options);
+
+    /**
+     * Compare an index with the working directory.
+     * \exception Error is thrown if the diff cannot be calculated.
+     */
+    static Diff index_to_workdir(git_repository* repo, git_index* index,
+        const DiffOptions& options);
+
+    /// Return the number of changed files.
+    std::size_t size() const noexcept;
+
+    /// Determine if there are no changes.
+    bool empty() const noexcept { return size() == 0; }
+
+    /**
+     * Return the changed file with the given index.
+     * \exception Error is thrown if the index is out of range.
+     */
+    DiffDelta delta(std::size_t index) const;
+
+    /// Return views of all changed files.
+    std::vector<DiffDelta> deltas() const;
+
+    /**
+     * Count the changed files and lines.
+     *
+     * This loads the contents of all changed files.
+     *
+     * \exception Error is thrown if the statistics cannot be calculated.
+     */
+    DiffStats stats() const;
+
+    /**
+     * Stream the changes through callbacks.
+     *
+     * Each callback may be empty. File contents are only loaded if a hunk or line callback
+     * is given. Iteration stops as soon as a callback returns false.
+     *
+     * \return false if a callback stopped the iteration, true otherwise.
+     * \exception Error is thrown if the contents cannot be loaded. Exceptions thrown by
+     *            the callbacks are propagated.
+     */
+    bool for_each(const FileCallback& file_cb, const HunkCallback& hunk_cb = nullptr,
+        const LineCallback& line_cb = nullptr) const;
+
+    /// Return a non-owning pointer to the underlying git diff.
+    git_diff* get() const noexcept { return diff_.get(); }
+
+private:
+    LibGitDiff diff_{ nullptr, git_diff_free };
+};
+
+} // namespace git
+
+#endif
+
+// vi:ts=4:sw=4:sts=4:et
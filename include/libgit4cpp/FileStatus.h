@@ -0,0 +1,136 @@
+/**
+ * \file   FileStatus.h
+ * \date   Created on October 16, 2026
+ * \brief  Types describing the git status of files in a repository.
+ *
+ * \copyright Copyright 2023-2026 Deutsches Elektronen-Synchrotron (DESY), Hamburg
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation, either version 2.1 of the license, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#ifndef LIBGIT4CPP_FILESTATUS_H_
+#define LIBGIT4CPP_FILESTATUS_H_
+
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <gul14/escape.h>
+
+namespace git {
+
+/// Handling status of a file: What git will do with it.
+enum class Handling : unsigned char
+{
+    unchanged, unstaged, staged, untracked, ignored
+};
+
+/// Change status of a file: How the file differs from the last commit.
+enum class Change : unsigned char
+{
+    unchanged, new_file, modified, deleted, renamed, typechange, untracked, ignored
+};
+
+/// Return the name of a handling status (e.g. "staged").
+std::string_view to_string(Handling handling) noexcept;
+
+/// Return the name of a change status (e.g. "new file").
+std::string_view to_string(Change change) noexcept;
+
+inline std::ostream& operator<<(std::ostream& stream, Handling handling)
+{
+    return stream << to_string(handling);
+}
+
+inline std::ostream& operator<<(std::ostream& stream, Change change)
+{
+    return stream << to_string(change);
+}
+
+/**
+ * Struct to express the git status for one file
+ */
+struct FileStatus
+{
+    std::string path_name; /// Relative path to file. If the path changed this value will have the shape "OLD_NAME -> NEW_NAME".
+    std::string handling;  /// Handling status of file [unchanged, unstaged, staged, untracked, ignored]
+    std::string changes;   /// Change status of file [new file, deleted, renamed, typechanged, modified, unchanged, ignored, untracked]
+
+    friend std::ostream& operator<<(std::ostream& stream, FileStatus const& state) {
+        stream << "FileStatus{ \"" << gul14::escape(state.path_name) << "\": " << state.handling << "; " << state.changes << " }";
+        return stream;
+    }
+};
+
+using RepoState = std::vector<FileStatus>; /// State of all files in the repo
+
+inline std::ostream& operator<<(std::ostream& stream, const RepoState& repostate)
+{
+    stream << "RepoState {\n";
+    for (auto& e : repostate)
+        stream << e << '\n';
+    stream << "}";
+    return stream;
+}
+
+/**
+ * Compact representation of the git status of one file.
+ *
+ * This carries the same information as FileStatus, but the handling and change status
+ * are stored as enums. Only the path needs a string, so collecting the status of many
+ * files needs about half the memory, and comparing the status is a simple integer
+ * comparison.
+ */
+struct CompactFileStatus
+{
+    /// Relative path to file. If the path changed this value will have the shape "OLD_NAME -> NEW_NAME".
+    std::string path_name;
+    /// Handling status of file
+    Handling handling = Handling::unchanged;
+    /// Change status of file
+    Change changes = Change::unchanged;
+
+    friend bool operator==(const CompactFileStatus& a, const CompactFileStatus& b)
+    {
+        return a.handling == b.handling && a.changes == b.changes
+            && a.path_name == b.path_name;
+    }
+
+    friend bool operator!=(const CompactFileStatus& a, const CompactFileStatus& b)
+    {
+        return !(a == b);
+    }
+
+    friend std::ostream& operator<<(std::ostream& stream, CompactFileStatus const& state) {
+        stream << "FileStatus{ \"" << gul14::escape(state.path_name) << "\": " << state.handling << "; " << state.changes << " }";
+        return stream;
+    }
+};
+
+using CompactRepoState = std::vector<CompactFileStatus>; ///< Compact state of all files in the repo
+
+/// Convert a CompactFileStatus into the string-based FileStatus.
+FileStatus to_file_status(const CompactFileStatus& status);
+
+/// Convert a CompactRepoState into the string-based RepoState.
+RepoState to_repo_state(const CompactRepoState& state);
+
+} // namespace git
+
+#endif
+
+// vi:ts=4:sw=4:sts=4:et
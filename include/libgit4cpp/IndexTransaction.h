@@ -0,0 +1,128 @@
+/**
+ * \file   IndexTransaction.h
+ * \date   Created on October 16, 2026
+ * \brief  Declaration of the IndexTransaction class.
+ *
+ * \copyright Copyright 2026 Deutsches Elektronen-Synchrotron (DESY), Hamburg
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation, either version 2.1 of the license, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#ifndef LIBGIT4CPP_INDEXTRANSACTION_H_
+#define LIBGIT4CPP_INDEXTRANSACTION_H_
+
+#include <filesystem>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "libgit4cpp/Repository.h"
+
+namespace git {
+
+/**
+ * A batch of staging operations on the index of a repository that is written to disk
+ * at once.
+ *
+ * While the transaction is active, all staging operations only modify the index in
+ * memory. write() stores the result on disk with a single index write. If the
+ * transaction is destroyed without calling write() (for instance because an exception
+ * was thrown), all modifications made through it are discarded.
+ *
+ * \code{.cpp}
+ * Repository repo{ "/path/to/repo" };
+ * {
+ *     IndexTransaction transaction{ repo };
+ *     for (const auto& files : changed_sequences)
+ *         transaction.add_files(files);
+ *     transaction.remove_directory("obsolete_sequence");
+ *     transaction.write();
+ * }
+ * repo.commit("Update sequences");
+ * \endcode
+ *
+ * Only one transaction can be active per Repository object at a time.
+ */
+class IndexTransaction
+{
+public:
+    /**
+     * Start a transaction on the index of the given repository.
+     *
+     * Modifications of the index which are still pending from deferred index writing
+     * (see Repository::set_deferred_index_write()) are written before the transaction
+     * starts, so that a rollback does not affect them.
+     *
+     * \exception Error is thrown if another transaction is already active on the
+     *            repository or if pending modifications cannot be written.
+     */
+    explicit IndexTransaction(Repository& repo);
+
+    /// Roll back the transaction if it has not been written.
+    ~IndexTransaction();
+
+    IndexTransaction(const IndexTransaction&) = delete;
+    IndexTransaction& operator=(const IndexTransaction&) = delete;
+
+    /// Stage files matching a glob (see Repository::add()).
+    void add(const std::string& glob = "*");
+
+    /// Update tracked files matching a glob (see Repository::update()).
+    void update(const std::string& glob = "*");
+
+    /// Stage specific files (see Repository::add_files()).
+    std::vector<int> add_files(const std::vector<std::filesystem::path>& filepaths);
+
+    /// Stage content from memory as a file (see Repository::stage_buffer()).
+    void stage_buffer(const std::filesystem::path& path, std::string_view content,
+        git_filemode_t mode = GIT_FILEMODE_BLOB);
+
+    /// Remove specific files from the index (see Repository::remove_files()).
+    void remove_files(const std::vector<std::filesystem::path>& filepaths);
+
+    /// Remove all index entries under a directory (see Repository::remove_directory()).
+    void remove_directory(const std::filesystem::path& directory);
+
+    /**
+     * Write all modifications to disk and end the transaction.
+     * \exception Error is thrown if the transaction is no longer active or if the index
+     *            cannot be written. In the latter case, the transaction stays active.
+     */
+    void write();
+
+    /// Discard all modifications and end the transaction. Does nothing if not active.
+    void rollback() noexcept;
+
+    /// Determine if the transaction has neither been written nor rolled back.
+    bool is_active() const noexcept { return active_; }
+
+private:
+    Repository& repo_;
+    bool previously_deferred_;
+    bool active_ = true;
+
+    /// Throw if the transaction is no longer active.
+    void check_active() const;
+
+    /// Restore the previous index write mode and release the repository.
+    void finish() noexcept;
+};
+
+} // namespace git
+
+#endif
+
+// vi:ts=4:sw=4:sts=4:et
@@ -0,0 +1,129 @@
+/**
+ * \file   Library.h
+ * \date   Created on October 16, 2026
+ * \brief  Process-wide initialization of libgit2 and its global options.
+ *
+ * \copyright Copyright 2026 Deutsches Elektronen-Synchrotron (DESY), Hamburg
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation, either version 2.1 of the license, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#ifndef LIBGIT4CPP_LIBRARY_H_
+#define LIBGIT4CPP_LIBRARY_H_
+
+#include <cstddef>
+#include <map>
+
+#include <git2.h>
+#include <gul14/optional.h>
+
+namespace git {
+
+/**
+ * Process-wide settings of libgit2.
+ *
+ * Members that are not set keep their current value (initially the libgit2 default).
+ * get_global_options() only fills in the members that libgit2 can report.
+ */
+struct GlobalOptions
+{
+    /// Enable the object cache (GIT_OPT_ENABLE_CACHING).
+    gul14::optional<bool> caching;
+    /// Maximum size of the object cache in bytes (GIT_OPT_SET_CACHE_MAX_SIZE).
+    gul14::optional<std::size_t> cache_max_size;
+    /**
+     * Largest object of a given type that is stored in the object cache, in bytes
+     * (GIT_OPT_SET_CACHE_OBJECT_LIMIT). A limit of 0 disables caching for the type.
+     */
+    std::map<git_object_t, std::size_t> cache_object_limits;
+    /// Size of the memory windows used to map pack files (GIT_OPT_SET_MWINDOW_SIZE).
+    gul14::optional<std::size_t> mwindow_size;
+    /// Maximum amount of memory mapped from pack files (GIT_OPT_SET_MWINDOW_MAPPED_LIMIT).
+    gul14::optional<std::size_t> mwindow_mapped_limit;
+    /**
+     * Maximum number of pack files kept open at the same time, 0 for no limit
+     * (GIT_OPT_SET_MWINDOW_FILE_LIMIT). Requires libgit2 1.1 or newer.
+     */
+    gul14::optional<std::size_t> mwindow_file_limit;
+    /**
+     * Validate the existence and type of referenced objects when creating new ones
+     * (GIT_OPT_ENABLE_STRICT_OBJECT_CREATION). Switching this off speeds up commits.
+     */
+    gul14::optional<bool> strict_object_creation;
+    /**
+     * Verify the hash of every object read from the object database
+     * (GIT_OPT_ENABLE_STRICT_HASH_VERIFICATION). Switching this off speeds up reading
+     * from trusted repositories.
+     */
+    gul14::optional<bool> strict_hash_verification;
+
+    /// Amount of memory currently used by the object cache (only reported).
+    gul14::optional<std::size_t> cached_memory;
+};
+
+/**
+ * A handle that keeps libgit2 initialized.
+ *
+ * libgit2 reference-counts its initialization and tears down its global state (caches,
+ * thread-local storage, TLS context, memory windows) whenever the count drops to zero.
+ * To avoid doing this over and over again when repositories are opened and closed, the
+ * first Library object initializes libgit2 for the rest of the process lifetime; it is
+ * shut down when static objects are destroyed.
+ *
+ * Repository and Remote hold a Library object, so there is usually no need to create
+ * one explicitly. Constructing a Library is cheap after the first time.
+ */
+class Library
+{
+public:
+    /// Make sure that libgit2 is initialized.
+    Library();
+};
+
+/**
+ * Apply global options to libgit2.
+ *
+ * The options affect all repositories in the process. They are best set once at
+ * startup before any repository is opened. libgit2 is initialized if necessary.
+ *
+ * \code
+ * git::GlobalOptions options;
+ * options.cache_max_size = 1024 * 1024 * 1024;
+ * options.strict_object_creation = false;
+ * git::set_global_options(options);
+ * \endcode
+ *
+ * \exception Error is thrown if libgit2 rejects an option or if an option is not
+ *            supported by the libgit2 version in use.
+ */
+void set_global_options(const GlobalOptions& options);
+
+/**
+ * Query the current global options of libgit2.
+ *
+ * Only the members which libgit2 can report are set: cache_max_size, cached_memory,
+ * mwindow_size, mwindow_mapped_limit and (with libgit2 1.1 or newer)
+ * mwindow_file_limit.
+ *
+ * \exception Error is thrown if libgit2 cannot report an option.
+ */
+GlobalOptions get_global_options();
+
+} // namespace git
+
+#endif
+
+// vi:ts=4:sw=4:sts=4:et
@@ -0,0 +1,130 @@
+/**
+ * \file   ObjectCache.h
+ * \date   Created on October 16, 2026
+ * \brief  Declaration of the ObjectCache class.
+ *
+ * \copyright Copyright 2026 Deutsches Elektronen-Synchrotron (DESY), Hamburg
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation, either version 2.1 of the license, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#ifndef LIBGIT4CPP_OBJECTCACHE_H_
+#define LIBGIT4CPP_OBJECTCACHE_H_
+
+#include <cstddef>
+#include <list>
+#include <unordered_map>
+
+#include <git2.h>
+
+#include "libgit4cpp/Oid.h"
+#include "libgit4cpp/types.h"
+
+namespace git {
+
+/// Counters of an ObjectCache.
+struct ObjectCacheStats
+{
+    /// Number of lookups answered from the cache.
+    std::size_t hits = 0;
+    /// Number of lookups that had to go to the object database.
+    std::size_t misses = 0;
+    /// Number of objects dropped to stay within the byte budget.
+    std::size_t evictions = 0;
+    /// Number of objects currently in the cache.
+    std::size_t entries = 0;
+    /// Estimated memory used by the cached objects in bytes.
+    std::size_t bytes = 0;
+};
+
+/**
+ * A least-recently-used cache of decoded commit and tree objects.
+ *
+ * Each Repository has an ObjectCache that it uses for looking up commits and trees, so
+ * that a sequence of operations on the same revision decodes the objects only once.
+ * libgit2 objects are reference-counted: get() hands out its own reference to the cached
+ * object, which stays valid even if the cache drops the object later.
+ *
+ * The memory used by an object is estimated from its content (message length for
+ * commits, number of entries for trees). When the estimated total exceeds the byte
+ * budget, the least recently used objects are dropped.
+ *
+ * An ObjectCache is bound to one git_repository and must be cleared before that
+ * repository is freed.
+ */
+class ObjectCache
+{
+public:
+    /// Default byte budget (4 MiB).
+    static constexpr std::size_t default_byte_budget = 4 * 1024 * 1024;
+
+    /// Construct an empty cache with the given byte budget (0 disables caching).
+    explicit ObjectCache(std::size_t byte_budget = default_byte_budget);
+
+    ObjectCache(const ObjectCache&) = delete;
+    ObjectCache& operator=(const ObjectCache&) = delete;
+
+    /**
+     * Return an object from the cache or look it up in the repository.
+     * \param repo  Repository to look up the object in on a cache miss
+     * \param id    ID of the object
+     * \param type  Expected type of the object (e.g. GIT_OBJECT_COMMIT)
+     * \return an owning pointer to the object.
+     * \exception Error is thrown if the object does not exist or has a different type.
+     */
+    LibGitObject get(git_repository* repo, const Oid& id, git_object_t type);
+
+    /// Drop all objects from the cache (the counters are kept).
+    void clear() noexcept;
+
+    /// Return the byte budget.
+    std::size_t byte_budget() const noexcept { return byte_budget_; }
+
+    /// Set the byte budget; objects are dropped immediately if necessary.
+    void set_byte_budget(std::size_t byte_budget);
+
+    /// Return the current counters.
+    ObjectCacheStats stats() const noexcept;
+
+    /// Reset the hit, miss and eviction counters to zero.
+    void reset_stats() noexcept;
+
+private:
+    struct Entry
+    {
+        Oid id;
+        LibGitObject object;
+        std::size_t bytes;
+    };
+
+    /// Objects in order of use, most recently used first.
+    std::list<Entry> lru_;
+    std::unordered_map<Oid, std::list<Entry>::iterator> index_;
+    std::size_t byte_budget_;
+    std::size_t bytes_ = 0;
+    std::size_t hits_ = 0;
+    std::size_t misses_ = 0;
+    std::size_t evictions_ = 0;
+
+    /// Drop least recently used objects until the budget is met.
+    void evict();
+};
+
+} // namespace git
+
+#endif
+
+// vi:ts=4:sw=4:sts=4:et
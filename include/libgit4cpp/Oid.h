@@ -0,0 +1,134 @@
+/**
+ * \file   Oid.h
+ * \date   Created on October 16, 2026
+ * \brief  Declaration of the Oid class.
+ *
+ * \copyright Copyright 2026 Deutsches Elektronen-Synchrotron (DESY), Hamburg
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation, either version 2.1 of the license, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#ifndef LIBGIT4CPP_OID_H_
+#define LIBGIT4CPP_OID_H_
+
+#include <cstddef>
+#include <cstring>
+#include <functional>
+#include <ostream>
+#include <string>
+#include <string_view>
+
+#include <git2.h>
+
+namespace git {
+
+/**
+ * The ID of a git object (a SHA-1 or SHA-256 hash) as a small value type.
+ *
+ * An Oid wraps a git_oid without any allocation. It can be compared, ordered, used as a
+ * key in hash maps and converted to a hexadecimal string on demand:
+ *
+ * \code{.cpp}
+ * git::Oid last_seen;
+ * ...
+ * if (auto head = repo.head_oid(); head != last_seen)
+ * {
+ *     std::cout << "HEAD moved to " << head.to_string() << '\n';
+ *     last_seen = head;
+ * }
+ * \endcode
+ */
+class Oid
+{
+public:
+    /// Construct a zero ID.
+    Oid() noexcept = default;
+
+    /// Construct an Oid from a libgit2 object ID.
+    Oid(const git_oid& id) noexcept : id_(id) { }
+
+    /**
+     * Parse an Oid from its full hexadecimal representation.
+     * \exception Error is thrown if the string is not a valid object ID.
+     */
+    static Oid from_string(std::string_view hex);
+
+    /// Return the underlying libgit2 object ID.
+    const git_oid& get() const noexcept { return id_; }
+
+    /// Return the underlying libgit2 object ID.
+    operator const git_oid&() const noexcept { return id_; }
+
+    /// Return a pointer to the raw bytes of the ID.
+    const unsigned char* data() const noexcept { return id_.id; }
+
+    /// Return the number of raw bytes (20 for SHA-1).
+    static constexpr std::size_t size() noexcept { return sizeof(git_oid::id); }
+
+    /// Determine if this is the zero ID (e.g. for a default-constructed Oid).
+    bool is_zero() const noexcept;
+
+    /// Return the full hexadecimal representation.
+    std::string to_string() const;
+
+    /// Return the first length hexadecimal digits (e.g. "4a8f2c1" for length 7).
+    std::string to_short_string(std::size_t length = 7) const;
+
+    friend bool operator==(const Oid& a, const Oid& b) noexcept
+    {
+        return std::memcmp(a.id_.id, b.id_.id, size()) == 0;
+    }
+
+    friend bool operator!=(const Oid& a, const Oid& b) noexcept { return not (a == b); }
+
+    friend bool operator<(const Oid& a, const Oid& b) noexcept
+    {
+        return std::memcmp(a.id_.id, b.id_.id, size()) < 0;
+    }
+
+    friend bool operator>(const Oid& a, const Oid& b) noexcept { return b < a; }
+    friend bool operator<=(const Oid& a, const Oid& b) noexcept { return not (b < a); }
+    friend bool operator>=(const Oid& a, const Oid& b) noexcept { return not (a < b); }
+
+private:
+    git_oid id_{ };
+};
+
+/// Write the full hexadecimal representation of an Oid to a stream.
+std::ostream& operator<<(std::ostream& stream, const Oid& oid);
+
+} // namespace git
+
+namespace std {
+
+/// Hash an Oid; the ID is a cryptographic hash, so its first bytes are used directly.
+template <>
+struct hash<git::Oid>
+{
+    std::size_t operator()(const git::Oid& oid) const noexcept
+    {
+        std::size_t result;
+        static_assert(sizeof(result) <= git::Oid::size(), "Object ID too short for hash");
+        std::memcpy(&result, oid.data(), sizeof(result));
+        return result;
+    }
+};
+
+} // namespace std
+
+#endif
+
+// vi:ts=4:sw=4:sts=4:et
@@ -25,16 +25,86 @@
 #ifndef LIBGIT4CPP_REMOTE_H_
 #define LIBGIT4CPP_REMOTE_H_
 
+#include <cstdint>
+#include <memory>
 #include <string>
+#include <vector>
 
 #include <git2.h>
 #include <gul14/optional.h>
 #include <gul14/SmallVector.h>
 
+#include "libgit4cpp/Library.h"
+#include "libgit4cpp/Oid.h"
 #include "libgit4cpp/types.h"
 
 namespace git {
 
+/// Direction of a connection to a remote.
+enum class Direction { fetch, push };
+
+/// A reference advertised by a remote repository, see Remote::list_references().
+struct RemoteHead
+{
+    /// Full name of the reference (e.g. "refs/heads/main" or "HEAD").
+    std::string name;
+    /// ID of the object the reference points to on the remote.
+    Oid oid;
+    /**
+     * ID of the corresponding object in the local repository. This and is_local are
+     * only filled in by libgit2 after a fetch has negotiated on the same connection.
+     */
+    Oid local_oid;
+    /// True if the object is known to exist in the local repository.
+    bool is_local = false;
+    /// Target of a symbolic reference (e.g. "refs/heads/main" for "HEAD"), or empty.
+    std::string symref_target;
+};
+
+/// Bookkeeping shared by a Remote and the RemoteConnection objects it hands out.
+struct RemoteConnectionState;
+
+/**
+ * An open connection to a remote, obtained from Remote::connect().
+ *
+ * The connection is closed when the object is destroyed or when close() is called.
+ * Once the Remote has been disconnected or connected anew, or once the Remote itself
+ * has been destroyed, the object is stale: is_open() returns false and close() does
+ * nothing, so it never affects a newer connection.
+ */
+class RemoteConnection
+{
+public:
+    RemoteConnection(const RemoteConnection&) = delete;
+    RemoteConnection& operator=(const RemoteConnection&) = delete;
+
+    /// Move constructor: The other object no longer owns the connection.
+    RemoteConnection(RemoteConnection&& other) noexcept;
+
+    /// Move assignment: Close the current connection and take over the other one.
+    RemoteConnection& operator=(RemoteConnection&& other) noexcept;
+
+    /// Destructor: Close the connection.
+    ~RemoteConnection() { close(); }
+
+    /// Close the connection (does nothing if it is closed or stale already).
+    void close() noexcept;
+
+    /// Return true if this object owns a connection that is still open.
+    bool is_open() const noexcept;
+
+private:
+    friend class Remote;
+
+    /// State of the Remote (null after close() or a move).
+    std::shared_ptr<RemoteConnectionState> state_;
+    /// Generation of the Remote's connection that this object owns.
+    std::uint64_t generation_ = 0;
+
+    RemoteConnection(std::shared_ptr<RemoteConnectionState> state,
+        std::uint64_t generation) noexcept;
+};
+
 /**
  * An abstraction of a git remote repository (such as "origin").
  *
@@ -53,6 +123,12 @@ public:
      */
     Remote(LibGitRemote&& remote_ptr);
 
+    Remote(Remote&& other) noexcept;
+    Remote& operator=(Remote&& other) noexcept;
+
+    /// Destructor: Outstanding RemoteConnection objects become stale.
+    ~Remote();
+
     /// Return a non-owning pointer to the underlying git remote object.
     git_remote* get() const { return remote_.get(); }
 
@@ -62,18 +138,64 @@ public:
     /// Return the URL of the remote (e.g. "https://gitlab.com/a/b.git").
     std::string get_url() const;
 
+    /**
+     * Open a connection to the remote.
+     *
+     * The references advertised by the remote when the connection is established can be
+     * listed any number of times with list_references(). In addition, the connection
+     * can carry a single transfer: one Repository::fetch() if it was opened with
+     * Direction::fetch, or one Repository::push() if it was opened with
+     * Direction::push. The server side ends the session after such a transfer, so any
+     * further fetch or push (and any transfer in the other direction) closes this
+     * connection and connects anew.
+     *
+     * \code{.cpp}
+     * auto connection = remote.connect();
+     * auto heads = remote.list_references();
+     * if (needs_update(heads))
+     *     repo.fetch(remote); // uses the same connection
+     * \endcode
+     *
+     * If the remote is connected already, that connection is closed first.
+     *
+     * \exception Error is thrown if the connection cannot be established.
+     */
+    RemoteConnection connect(Direction direction = Direction::fetch);
+
+    /**
+     * Close the connection to the remote, if any. Outstanding RemoteConnection objects
+     * become stale.
+     */
+    void disconnect() noexcept;
+
+    /// Return true if there is an open connection to the remote.
+    bool is_connected() const noexcept;
+
     /**
      * Retrieve a list of references available on this remote repository
      * ("git ls-remote").
      *
-     * \note
-     * The API for this function is preliminary. It would be more useful to return not
-     * just the names of the references, but also additional details like the commit IDs.
+     * An open connection is reused. Otherwise, a temporary connection is established
+     * for this call only.
+     *
+     * \exception Error is thrown if the remote cannot be contacted.
      */
-    std::vector<std::string> list_references();
+    std::vector<RemoteHead> list_references();
 
 private:
+    friend class Repository;
+
+    Library library_;
     LibGitRemote remote_{ nullptr, git_remote_free };
+    std::shared_ptr<RemoteConnectionState> connection_;
+
+    /**
+     * Determine whether a transfer in the given direction can use the open connection.
+     *
+     * If so, the connection is marked as used and true is returned. Otherwise, an open
+     * connection is closed (so that libgit2 connects anew) and false is returned.
+     */
+    bool claim_connection(Direction direction) const noexcept;
 };
 
 } // namespace git
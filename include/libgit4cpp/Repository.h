@@ -25,45 +25,305 @@
 #ifndef LIBGIT4CPP_REPOSITORY_H_
 #define LIBGIT4CPP_REPOSITORY_H_
 
+#include <chrono>
+#include <cstddef>
 #include <filesystem>
+#include <functional>
+#include <map>
 #include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include <git2.h>
-#include <gul14/escape.h>
 
+#include "libgit4cpp/BlobView.h"
+#include "libgit4cpp/CommitRange.h"
+#include "libgit4cpp/Diff.h"
+#include "libgit4cpp/FileStatus.h"
+#include "libgit4cpp/Library.h"
+#include "libgit4cpp/ObjectCache.h"
+#include "libgit4cpp/Oid.h"
 #include "libgit4cpp/Remote.h"
+#include "libgit4cpp/StatusList.h"
 #include "libgit4cpp/types.h"
 
 namespace git {
 
+enum class BranchType {all = 0, local =1, remote=2};
+
 /**
- * Struct to express the git status for one file
+ * Determine what the Repository constructor does if there is no repository at the given
+ * path yet.
  */
-struct FileStatus
+enum class OpenMode
 {
-    std::string path_name; /// Relative path to file. If the path changed this value will have the shape "OLD_NAME -> NEW_NAME".
-    std::string handling;  /// Handling status of file [unchanged, unstaged, staged, untracked, ignored]
-    std::string changes;   /// Change status of file [new file, deleted, renamed, typechanged, modified, unchanged, ignored, untracked]
+    /// Only open an existing repository; throw if there is none.
+    open_only,
+    /// Create a bare repository (without working directory and without initial commit).
+    init_bare,
+    /// Create a repository with a working directory and commit all tracked files.
+    init_with_workdir
+};
 
-    friend std::ostream& operator<<(std::ostream& stream, FileStatus const& state) {
-        stream << "FileStatus{ \"" << gul14::escape(state.path_name) << "\": " << state.handling << "; " << state.changes << " }";
-        return stream;
+/// Options for Repository::maintenance().
+struct MaintenanceOptions
+{
+    /// Delete loose objects after they have been packed.
+    bool prune_loose_objects = true;
+    /// Write a multi-pack-index over all pack files (requires libgit2 1.2 or newer).
+    bool write_multi_pack_index = false;
+    /// Write or refresh the commit-graph file (requires libgit2 1.2 or newer).
+    bool write_commit_graph = false;
+    /// Number of threads used for packing (0: number of CPUs).
+    unsigned int threads = 1;
+};
+
+/// Results of Repository::maintenance().
+struct MaintenanceStats
+{
+    /// Number of loose objects that were written into the new pack file.
+    std::size_t objects_packed = 0;
+    /// Number of loose object files that were deleted.
+    std::size_t loose_objects_removed = 0;
+    /// Size of the loose object files that were packed in bytes.
+    std::size_t loose_bytes = 0;
+    /// Size of the new pack file in bytes.
+    std::size_t pack_bytes = 0;
+    /// Time spent in maintenance().
+    std::chrono::steady_clock::duration duration{ };
+
+    /// Return the number of bytes saved on disk (may be negative for tiny packs).
+    std::ptrdiff_t bytes_saved() const noexcept
+    {
+        if (loose_objects_removed == 0)
+            return 0;
+        return static_cast<std::ptrdiff_t>(loose_bytes)
+            - static_cast<std::ptrdiff_t>(pack_bytes);
     }
 };
 
-using RepoState = std::vector<FileStatus>; /// State of all files in the repo
+/// Options for creating a new repository with Repository::create().
+struct InitOptions
+{
+    /// Create a bare repository instead of one with a working directory.
+    bool bare = false;
+    /// Stage all files in the working directory and make an initial commit.
+    bool initial_commit = false;
+    /// Name of the branch HEAD initially points to.
+    std::string initial_head = "main";
+};
 
-inline std::ostream& operator<<(std::ostream& stream, const RepoState& repostate)
+/**
+ * Options to select which files are reported by Repository::status().
+ *
+ * A default-constructed object reproduces the behavior of the parameterless status():
+ * Every file of the working directory is listed, including unmodified and ignored ones.
+ * On large repositories it is much cheaper to switch these off, because libgit2 then
+ * only has to report the files that actually differ from HEAD:
+ *
+ * \code{.cpp}
+ * StatusOptions opts;
+ * opts.include_unmodified = false;
+ * opts.include_ignored = false;
+ * bool anything_to_commit = not repo.status(opts).empty();
+ * \endcode
+ */
+struct StatusOptions
 {
-    stream << "RepoState {\n";
-    for (auto& e : repostate)
-        stream << e << '\n';
-    stream << "}";
-    return stream;
-}
+    /// Report files which are unchanged since the last commit.
+    bool include_unmodified = true;
+    /// Report files which are not tracked by git.
+    bool include_untracked = true;
+    /// Report the files inside untracked directories instead of just the directory.
+    bool recurse_untracked_dirs = true;
+    /// Report files which are ignored via .gitignore.
+    bool include_ignored = true;
+    /// Detect renamed files in the index and in the working directory.
+    bool detect_renames = false;
+    /// Restrict the status to files matching one of these patterns (empty: all files).
+    std::vector<std::string> pathspec;
+    /// Treat the entries of pathspec as literal paths instead of glob patterns.
+    bool pathspec_literal = false;
+};
 
-enum class BranchType {all = 0, local =1, remote=2};
+/// Determine which tags are downloaded by Repository::fetch().
+enum class TagPolicy
+{
+    /// Use the setting from the remote configuration (remote.<name>.tagOpt).
+    unspecified,
+    /// Download tags that point to objects which are fetched anyway (git's default).
+    auto_follow,
+    /// Do not download any tags.
+    none,
+    /// Download all tags of the remote.
+    all
+};
+
+/**
+ * Transfer statistics of a fetch operation.
+ *
+ * An object of this type is passed to the progress callback of FetchOptions while the
+ * transfer is running and is returned by Repository::fetch() when it has finished.
+ */
+struct FetchStats
+{
+    /// Number of objects the remote is going to send.
+    std::size_t total_objects = 0;
+    /// Number of objects received so far.
+    std::size_t received_objects = 0;
+    /// Number of received objects that have been indexed.
+    std::size_t indexed_objects = 0;
+    /// Number of objects that were not sent because they exist locally.
+    std::size_t local_objects = 0;
+    /// Number of deltas in the received pack.
+    std::size_t total_deltas = 0;
+    /// Number of deltas resolved so far.
+    std::size_t indexed_deltas = 0;
+    /// Number of bytes received from the remote so far.
+    std::size_t received_bytes = 0;
+    /// Time elapsed since the fetch was started.
+    std::chrono::steady_clock::duration duration{ };
+
+    /// Return the average download rate in bytes per second (0 if no time has elapsed).
+    double bytes_per_second() const noexcept
+    {
+        const auto seconds = std::chrono::duration<double>(duration).count();
+        return seconds > 0.0 ? received_bytes / seconds : 0.0;
+    }
+};
+
+/**
+ * Options for Repository::fetch().
+ *
+ * A default-constructed object fetches the refspecs configured for the remote, follows
+ * tags automatically and prunes only if the remote is configured to do so:
+ *
+ * \code{.cpp}
+ * FetchOptions opts;
+ * opts.prune = true;
+ * opts.progress = [](const FetchStats& s) {
+ *     std::cout << s.received_objects << "/" << s.total_objects << "\n";
+ *     return true; // return false to cancel the fetch
+ * };
+ * auto stats = repo.fetch(*repo.get_remote("origin"), opts);
+ * \endcode
+ */
+struct FetchOptions
+{
+    /// Refspecs to fetch (empty: use the refspecs configured for the remote).
+    std::vector<std::string> refspecs;
+    /**
+     * Delete remote-tracking branches which no longer exist on the remote. If false,
+     * the configuration of the remote (remote.<name>.prune, fetch.prune) decides.
+     */
+    bool prune = false;
+    /**
+     * Fetch only this many commits per branch (0: full history). Needs libgit2 1.7 and
+     * a transport that supports shallow fetches (https, ssh, git). libgit2's local
+     * transport (file:// URLs and local paths) rejects shallow fetches with an error.
+     */
+    unsigned int depth = 0;
+    /// Which tags to download.
+    TagPolicy tags = TagPolicy::auto_follow;
+    /// Called repeatedly during the transfer; return false to cancel the fetch.
+    std::function<bool(const FetchStats&)> progress;
+};
+
+/// Transfer statistics of a push operation, see PushOptions.
+struct PushStats
+{
+    /// Number of objects that are going to be sent.
+    std::size_t total_objects = 0;
+    /// Number of objects sent so far.
+    std::size_t sent_objects = 0;
+    /// Number of bytes sent so far.
+    std::size_t sent_bytes = 0;
+    /// Time elapsed since the push was started.
+    std::chrono::steady_clock::duration duration{ };
+
+    /// Return the average upload rate in bytes per second (0 if no time has elapsed).
+    double bytes_per_second() const noexcept
+    {
+        const auto seconds = std::chrono::duration<double>(duration).count();
+        return seconds > 0.0 ? sent_bytes / seconds : 0.0;
+    }
+};
+
+/// Options for Repository::push().
+struct PushOptions
+{
+    /// Refspecs to push (empty: use the push refspecs configured for the remote).
+    std::vector<std::string> refspecs;
+    /// Called repeatedly during the transfer; return false to cancel the push.
+    std::function<bool(const PushStats&)> progress;
+};
+
+/// Determine how Repository::clone() handles sources on the local filesystem.
+enum class LocalClone
+{
+    /// Copy objects directly for plain local paths, use the git transport for URLs.
+    automatic,
+    /// Copy objects directly even for file:// URLs.
+    always,
+    /// Always use the git transport.
+    never,
+    /// Like always (copy directly even for file:// URLs), but never hardlink object files.
+    no_hardlinks
+};
+
+/**
+ * Options for Repository::clone().
+ *
+ * A default-constructed object produces the equivalent of a plain "git clone": all
+ * branches are fetched, the default branch of the remote is checked out.
+ */
+struct CloneOptions
+{
+    /// Create a bare repository without working directory.
+    bool bare = false;
+    /// Do not check out any files into the working directory.
+    bool no_checkout = false;
+    /// Branch to check out (empty: the default branch of the remote).
+    std::string branch;
+    /// Fetch only the given branch (requires branch to be set).
+    bool single_branch = false;
+    /**
+     * Fetch only this many commits per branch (0: full history). As for
+     * FetchOptions::depth, this needs libgit2 1.7 and a transport that supports shallow
+     * fetches; clones from the local filesystem are rejected with an error.
+     */
+    unsigned int depth = 0;
+    /**
+     * How to clone from the local filesystem. A direct copy hardlinks the object files
+     * if source and target reside on the same filesystem.
+     */
+    LocalClone local = LocalClone::automatic;
+    /// Called repeatedly during the transfer; return false to cancel the clone.
+    std::function<bool(const FetchStats&)> progress;
+};
+
+/// Result of Repository::ahead_behind().
+struct AheadBehind
+{
+    /// Number of commits on the local side that are not reachable from upstream.
+    std::size_t ahead = 0;
+    /// Number of commits on the upstream side that are not reachable from local.
+    std::size_t behind = 0;
+
+    /// Return true if both sides point to the same commit.
+    bool up_to_date() const noexcept { return ahead == 0 && behind == 0; }
+
+    friend bool operator==(const AheadBehind& a, const AheadBehind& b) noexcept
+    {
+        return a.ahead == b.ahead && a.behind == b.behind;
+    }
+    friend bool operator!=(const AheadBehind& a, const AheadBehind& b) noexcept
+    {
+        return not (a == b);
+    }
+};
 
 
 /**
@@ -82,9 +342,81 @@ public:
 
     /**
      * Constructor which specifies the root dir of the git repository.
-     * \param file_path  Path to git directory
+     *
+     * An existing repository (bare or with working directory) is always opened. If there
+     * is none, the mode determines whether a new one is created:
+     *
+     * - OpenMode::init_with_workdir (default): A repository is created in the given
+     *   directory and an initial commit is made.
+     * - OpenMode::init_bare: A bare repository is created at the given path. It has no
+     *   working directory, so it can only be modified through functions that do not use
+     *   the index (see TreeBuilder and create_commit()). HEAD points to the unborn
+     *   branch "main" until the first commit.
+     * - OpenMode::open_only: An Error is thrown.
+     *
+     * \param file_path  Path to git directory (or to the bare repository)
+     * \param mode       What to do if no repository exists at file_path
+     * \exception Error is thrown if the repository cannot be opened or created.
+     *
+     * \note The default mode walks the whole directory tree if the repository does not
+     *       exist yet. Use open() and create() to make this explicit.
+     */
+    explicit Repository(const std::filesystem::path& file_path,
+        OpenMode mode = OpenMode::init_with_workdir);
+
+    /**
+     * Open an existing repository without ever creating one.
+     *
+     * Only the given path is checked; parent directories are not searched. Opening is
+     * cheap: The index and the commit signature are only loaded when needed.
+     *
+     * \code
+     * auto repo = git::Repository::open("/path/to/repo");
+     * \endcode
+     *
+     * \param file_path  Path to git directory (or to the bare repository)
+     * \exception Error is thrown if there is no repository at file_path.
+     */
+    static Repository open(const std::filesystem::path& file_path);
+
+    /**
+     * Create a new repository.
+     *
+     * By default, the repository is empty and HEAD points to the unborn branch
+     * options.initial_head. Set options.initial_commit to stage and commit all files in
+     * the directory.
+     *
+     * \param file_path  Path to git directory (or to the bare repository)
+     * \param options    Options for the new repository
+     * \exception Error is thrown if a repository exists already at file_path or if it
+     *            cannot be created.
+     */
+    static Repository create(const std::filesystem::path& file_path,
+        const InitOptions& options = InitOptions{ });
+
+    /**
+     * Clone a remote repository into a new directory.
+     *
+     * \code{.cpp}
+     * git::CloneOptions opts;
+     * opts.branch = "release";
+     * opts.single_branch = true;
+     * auto repo = git::Repository::clone("https://gitlab.com/a/b.git", "/data/b", opts);
+     * \endcode
+     *
+     * A shallow clone (depth > 0) needs a transport that supports it (https, ssh, git);
+     * it cannot be made from the local filesystem.
+     *
+     * \param url        URL or local path of the repository to clone
+     * \param file_path  Path of the new repository (must not exist or be empty)
+     * \param options    Options for the clone
+     * \exception Error is thrown if the clone fails, if single_branch is requested
+     *            without a branch, or if a shallow clone is requested with
+     *            libgit2 < 1.7. Exceptions thrown by the progress callback are
+     *            propagated.
      */
-    explicit Repository(const std::filesystem::path& file_path);
+    static Repository clone(const std::string& url, const std::filesystem::path& file_path,
+        const CloneOptions& options = CloneOptions{ });
 
     /**
      * Reset all knowledge this object knows about the repository and load the knowledge again.
@@ -97,6 +429,77 @@ public:
     /// Returns a non-owning raw pointer to the current repository.
     git_repository* get_repo();
 
+    /// Determine if the repository is bare, i.e. has no working directory.
+    bool is_bare() const;
+
+    /**
+     * Return the ID of the commit HEAD points to.
+     *
+     * Only the reference files are read; no objects are loaded. This makes the function
+     * suitable for frequently polling a repository for external changes.
+     *
+     * \return the commit ID or a zero Oid if HEAD points to an unborn branch.
+     * \exception Error is thrown if HEAD cannot be read.
+     */
+    Oid head_oid();
+
+    /**
+     * Return the ID a reference points to, following symbolic references.
+     *
+     * Only the reference files are read; no objects are loaded.
+     *
+     * \param refname  Full name of the reference (e.g. "HEAD", "refs/heads/main",
+     *                  "refs/remotes/origin/main", "refs/tags/v1.0")
+     * \exception Error is thrown if the reference does not exist.
+     */
+    Oid resolve(const std::string& refname);
+
+    /**
+     * Return the cache of decoded commits and trees used by this object.
+     *
+     * It can be used to adjust the byte budget or to query the hit and miss counters:
+     *
+     * \code{.cpp}
+     * repo.object_cache().set_byte_budget(64 * 1024 * 1024);
+     * auto stats = repo.object_cache().stats();
+     * \endcode
+     */
+    ObjectCache& object_cache() noexcept { return object_cache_; }
+
+    /**
+     * Enable or disable deferred writing of the index.
+     *
+     * By default, every staging operation (add(), update(), add_files(), remove_files(),
+     * remove_directory()) writes the index file to disk. With deferred writing, the
+     * modifications are only kept in memory and written once by write_index(), by
+     * commit(), or when the Repository object is destroyed. Staging many files and then
+     * committing thus needs just one index read and one index write.
+     *
+     * Unwritten modifications are discarded by reset() and reset_repo(). Disabling the
+     * deferred mode writes pending modifications immediately.
+     *
+     * \see IndexTransaction for a scoped way of batching staging operations
+     *
+     * \param defer  True to keep index modifications in memory, false to write them
+     *               after every staging operation
+     * \exception Error is thrown if pending modifications cannot be written.
+     */
+    void set_deferred_index_write(bool defer);
+
+    /// Determine if index modifications are kept in memory until write_index() is called.
+    bool is_index_write_deferred() const noexcept { return defer_index_write_; }
+
+    /**
+     * Write pending modifications of the index to disk.
+     *
+     * This is only necessary if deferred index writing is enabled; otherwise, the index
+     * is always up to date on disk. If there are no pending modifications, the call does
+     * nothing.
+     *
+     * \exception Error is thrown if the index cannot be written.
+     */
+    void write_index();
+
     /**
      * Stage multiple new, changed, or removed files and folders in the repository directory.
      *
@@ -153,6 +556,24 @@ public:
      */
    std::vector <int> add_files(const std::vector<std::filesystem::path>& filepaths);
 
+    /**
+     * Stage the given content as a file without touching the working directory.
+     *
+     * The content is stored directly as a blob in the object database and the index
+     * entry for the given path is set to it. This saves writing the file to disk and
+     * having libgit2 read and hash it again. The working directory is not modified, so
+     * status() reports the file as deleted or modified there unless the same content is
+     * also written to disk.
+     *
+     * \param path     Path of the file relative to the repository root
+     * \param content  Content of the file
+     * \param mode     File mode of the index entry (normal or executable file, link)
+     * \exception Error is thrown if the blob cannot be created or the index entry cannot
+     *            be added.
+     */
+    void stage_buffer(const std::filesystem::path& path, std::string_view content,
+        git_filemode_t mode = GIT_FILEMODE_BLOB);
+
     /**
      * Return the commit message of the HEAD commit.
      * \return message of last commit (=HEAD)
@@ -165,6 +586,23 @@ public:
      */
     void commit(const std::string& commit_message);
 
+    /**
+     * Create a commit from a tree that has already been written to the object database.
+     *
+     * The current target of the given reference becomes the parent of the new commit,
+     * and the reference is updated to point to it. If the reference does not exist yet
+     * (e.g. an unborn branch), the commit has no parent. Neither the index nor the
+     * working directory is touched.
+     *
+     * \param tree_id         ID of the tree to commit (e.g. from TreeBuilder::write())
+     * \param commit_message  Message for the commit
+     * \param ref             Reference to update (e.g. "HEAD" or "refs/heads/main")
+     * \return the ID of the new commit.
+     * \exception Error is thrown if the commit cannot be created.
+     */
+    git_oid create_commit(const git_oid& tree_id, const std::string& commit_message,
+        const std::string& ref = "HEAD");
+
     /**
      * Hard reset of repository.
      * \param nr_of_commits number of commits to jump back
@@ -217,26 +655,40 @@ public:
      */
     void push(const Remote& remote, const std::string& refspec = "HEAD:refs/heads/main");
 
-#if 0
     /**
-     * Pull changes from the remote repository.
-     * \param addr Address of the git repository host
-     */
-    void pull();
-
-    /**
-     * Clone a repository.
-     * \param addr Address of the git repository host
+     * Push several refspecs to the specified remote in one transfer.
+     *
+     * An unused connection opened with Remote::connect(Direction::push) is used for the
+     * transfer; any other open connection is closed first.
+     *
+     * \param remote   The git remote to push to (e.g. obtained by get_remote())
+     * \param options  Refspecs to push and an optional progress callback
+     * \returns the final transfer statistics.
+     *
+     * \exception Error is thrown if the push fails or is cancelled by the progress
+     *            callback. Exceptions thrown by the progress callback are propagated.
      */
-    void clone_repo(const std::string& url, const std::filesystem::path& repo_path);
+    PushStats push(const Remote& remote, const PushOptions& options);
 
     /**
-     * Check if remote and local branch are in same state.
-     * \param branch_name
+     * Download objects and refs from a remote repository ("git fetch").
+     *
+     * Remote-tracking branches (e.g. "refs/remotes/origin/main") are updated according
+     * to the given refspecs or, if none are given, to those configured for the remote.
+     * Neither the working directory nor any local branch is modified. An unused
+     * connection opened with Remote::connect(Direction::fetch) is used for the
+     * transfer; any other open connection is closed first.
+     *
+     * \param remote   The git remote to fetch from (e.g. obtained by get_remote())
+     * \param options  Refspecs, pruning, shallow depth, tag policy and progress callback
+     * \returns the final transfer statistics.
+     *
+     * \exception Error is thrown if the fetch fails, if it was cancelled by the progress
+     *            callback, or if a shallow fetch is requested with libgit2 < 1.7 or over
+     *            a transport that does not support it.
+     *            Exceptions thrown by the progress callback are propagated.
      */
-    bool branch_up_to_date(const std::string& branch_name);
-
-#endif
+    FetchStats fetch(const Remote& remote, const FetchOptions& options = FetchOptions{});
 
 
     /**
@@ -329,22 +781,300 @@ public:
      */
     RepoState status();
 
+    /**
+     * Return the git status of the files selected by the given options.
+     *
+     * Only the requested categories of files are collected by libgit2, so leaving out
+     * unmodified and ignored files makes the cost of this call proportional to the
+     * number of changed files instead of the size of the repository.
+     *
+     * \param options  Selection of the files to report
+     * \return vector of file status for each selected file.
+     * \exception Error is thrown if the status cannot be retrieved.
+     */
+    RepoState status(const StatusOptions& options);
+
+    /**
+     * Return the git status of the files selected by the given options in compact form.
+     *
+     * This is the same as status(), but the handling and change status of each file is
+     * stored as an enum instead of a string.
+     *
+     * \param options  Selection of the files to report
+     * \return vector of compact file status for each selected file.
+     * \exception Error is thrown if the status cannot be retrieved.
+     */
+    CompactRepoState compact_status(const StatusOptions& options = StatusOptions{ });
+
+    /**
+     * Return the git status of the files selected by the given options as a lazy range.
+     *
+     * In contrast to status(), no per-file data is copied: The returned StatusList
+     * decodes each entry on demand while it is iterated over. This is the cheapest way
+     * to count the changed files or to stop at the first one.
+     *
+     * \code{.cpp}
+     * StatusOptions opts;
+     * opts.include_unmodified = false;
+     * opts.include_ignored = false;
+     * bool anything_to_commit = not repo.status_view(opts).empty();
+     * \endcode
+     *
+     * \param options  Selection of the files to report
+     * \return a StatusList which must not outlive this Repository.
+     * \exception Error is thrown if the status cannot be retrieved.
+     */
+    StatusList status_view(const StatusOptions& options = StatusOptions{ });
+
+    /**
+     * Return a lazy range over the commit history.
+     *
+     * By default, all commits reachable from HEAD are visited in the order libgit2
+     * finds them. See CommitRangeOptions for sorting and for selecting commits.
+     *
+     * \code{.cpp}
+     * CommitRangeOptions opts;
+     * opts.first_parent_only = true;
+     * for (const auto& commit : repo.commits(opts))
+     *     std::cout << commit.summary() << '\n';
+     * \endcode
+     *
+     * \param options  Selection and order of the commits
+     * \return a CommitRange which must not outlive this Repository.
+     * \exception Error is thrown if a revision cannot be resolved.
+     */
+    CommitRange commits(const CommitRangeOptions& options = CommitRangeOptions{ });
+
+    /**
+     * Return the commits that changed a file or directory ("git log -- path").
+     *
+     * The history of HEAD is walked from the newest commit on. A commit is reported if
+     * the tree entry of the path differs from the one in each of its parents (merge
+     * commits which take the entry from one of their parents are skipped). Tree entry
+     * IDs are compared directly, so no diff is calculated.
+     *
+     * Results are cached per path until HEAD moves.
+     *
+     * \param path   Path of a file or directory relative to the repository root
+     * \param limit  Maximum number of commits to return (0 for no limit)
+     * \return the matching commits, newest first. The list is empty if HEAD is unborn.
+     * \exception Error is thrown if the path is empty or the history cannot be read.
+     */
+    std::vector<CommitInfo> log(const std::filesystem::path& path, std::size_t limit = 0);
+
+    /**
+     * Compare the trees of two revisions ("git diff rev_a rev_b").
+     *
+     * \code{.cpp}
+     * auto stats = repo.diff("HEAD~1", "HEAD").stats();
+     * \endcode
+     *
+     * \param rev_a    Old revision (e.g. "HEAD~1"); an empty string means an empty tree
+     * \param rev_b    New revision (e.g. "HEAD"); an empty string means an empty tree
+     * \param options  Options for the comparison
+     * \return a Diff which must not outlive this Repository.
+     * \exception Error is thrown if a revision cannot be resolved to a tree.
+     */
+    Diff diff(const std::string& rev_a, const std::string& rev_b,
+        const DiffOptions& options = DiffOptions{ });
+
+    /**
+     * Compare the index with the working directory, i.e. list the unstaged changes
+     * ("git diff").
+     * \exception Error is thrown if the diff cannot be calculated.
+     */
+    Diff diff_index_to_workdir(const DiffOptions& options = DiffOptions{ });
+
+    /**
+     * Compare HEAD with the index, i.e. list the staged changes ("git diff --cached").
+     *
+     * If HEAD is unborn, all staged files are reported as new.
+     *
+     * \exception Error is thrown if the diff cannot be calculated.
+     */
+    Diff diff_head_to_index(const DiffOptions& options = DiffOptions{ });
+
+    /**
+     * Read a file as it was stored in a given revision.
+     *
+     * The content is read from the object database; neither the working directory nor
+     * the index are touched.
+     *
+     * \param revision  Revision to read from (e.g. "HEAD", "main~2", a commit ID)
+     * \param path      Path of the file relative to the repository root
+     * \return a BlobView which must not outlive this Repository.
+     * \exception Error is thrown if the revision cannot be resolved or if the path does
+     *            not refer to a file in it (the error code is GIT_ENOTFOUND if the path
+     *            does not exist).
+     */
+    BlobView read_blob(const std::string& revision, const std::filesystem::path& path);
+
+    /**
+     * Read several files as they were stored in a given revision.
+     *
+     * This is faster than calling read_blob() for each file: The revision is resolved
+     * only once, and each directory tree is looked up only once no matter how many of the
+     * requested files it contains.
+     *
+     * \param revision  Revision to read from (e.g. "HEAD", "main~2", a commit ID)
+     * \param paths     Paths of the files relative to the repository root
+     * \return one BlobView per path in the same order. The BlobViews must not outlive
+     *         this Repository.
+     * \exception Error is thrown if the revision cannot be resolved or if a path does not
+     *            refer to a file in it (the error code is GIT_ENOTFOUND if the path does
+     *            not exist).
+     */
+    std::vector<BlobView> read_blobs(const std::string& revision,
+        const std::vector<std::filesystem::path>& paths);
+
+    /**
+     * Write or refresh the commit-graph file of the repository.
+     *
+     * The commit-graph file (objects/info/commit-graph) stores the parents and
+     * generation numbers of all commits reachable from the references. After it has been
+     * written, core.commitGraph is enabled so that libgit2 uses it for history walks and
+     * ancestry queries (is_descendant_of(), merge_base()) instead of parsing each commit
+     * object. The file does not update itself: Call this function again after many new
+     * commits.
+     *
+     * \exception Error is thrown if the file cannot be written or if libgit2 is older
+     *            than version 1.2.
+     */
+    void write_commit_graph();
+
+    /**
+     * Pack the loose objects of the repository ("git gc" light).
+     *
+     * All loose objects are written into a new pack file with a packbuilder. Afterwards,
+     * the packed loose files are deleted and, optionally, a multi-pack-index and the
+     * commit-graph file are written. Loose objects created by other processes while the
+     * function runs are left alone, so it can be called periodically.
+     *
+     * Like all member functions, maintenance() must not be called concurrently with other
+     * operations on the same Repository object. To run it in a background thread, give
+     * that thread its own object:
+     *
+     * \code{.cpp}
+     * std::thread worker([path]() {
+     *     auto stats = git::Repository::open(path).maintenance();
+     *     std::cout << stats.objects_packed << " objects packed\n";
+     * });
+     * \endcode
+     *
+     * \param options  Selection of the maintenance tasks
+     * \return statistics about the work done
+     * \exception Error is thrown if packing fails or if an option is not supported by the
+     *            libgit2 version in use. Loose objects are only deleted after the pack has
+     *            been written successfully.
+     */
+    MaintenanceStats maintenance(const MaintenanceOptions& options = MaintenanceOptions{ });
+
+    /**
+     * Determine if a commit is a descendant of another one.
+     *
+     * A commit is not considered a descendant of itself.
+     *
+     * \param commit    Revision of the potential descendant (e.g. "HEAD")
+     * \param ancestor  Revision of the potential ancestor (e.g. "main~3")
+     * \exception Error is thrown if a revision cannot be resolved to a commit.
+     */
+    bool is_descendant_of(const std::string& commit, const std::string& ancestor);
+
+    /**
+     * Find the best common ancestor of two commits ("git merge-base").
+     * \param rev_a  First revision
+     * \param rev_b  Second revision
+     * \return the ID of the merge base
+     * \exception Error is thrown if a revision cannot be resolved or if the commits have
+     *            no common ancestor.
+     */
+    git_oid merge_base(const std::string& rev_a, const std::string& rev_b);
+
+    /**
+     * Count the commits by which two revisions have diverged ("git rev-list --count
+     * --left-right local...upstream").
+     *
+     * The result only depends on the two commit IDs, so it is cached: polling the same
+     * pair of branches again is cheap as long as neither of them has moved.
+     *
+     * \param local     Revision of the local side (e.g. "main")
+     * \param upstream  Revision of the upstream side (e.g. "origin/main")
+     * \exception Error is thrown if a revision cannot be resolved to a commit.
+     */
+    AheadBehind ahead_behind(const std::string& local, const std::string& upstream);
+
+    /**
+     * Check whether a local branch points to the same commit as its upstream branch.
+     *
+     * The upstream branch is the one configured for the local branch (e.g. by
+     * "git branch --set-upstream-to"), typically a remote-tracking branch like
+     * "origin/main". Call fetch() first to compare against the current remote state.
+     *
+     * \param branch_name  Name of the local branch (e.g. "main")
+     * \exception Error is thrown if the branch does not exist or has no upstream.
+     */
+    bool branch_up_to_date(const std::string& branch_name);
+
     /// Destructor
     ~Repository();
 
 private:
 
+    friend class IndexTransaction;
+
+    /// Keeps libgit2 initialized (must be constructed first and destroyed last).
+    Library library_;
+
     /// Path to the repository.
     std::filesystem::path repo_path_;
 
+    /// What init() does if there is no repository at repo_path_.
+    OpenMode open_mode_ = OpenMode::init_with_workdir;
+
     /// Pointer which holds all infos of the active repository.
     LibGitRepository repo_{ nullptr, git_repository_free };
 
-    /// Signature used in commits.
+    /// Recently used commits and trees (declared after repo_ so that it is freed first).
+    ObjectCache object_cache_;
+
+    /// Signature used in commits (loaded lazily by get_signature()).
     LibGitSignature my_signature_{ nullptr, git_signature_free };
 
+    /// Index of the repository, loaded on first use by get_index().
+    LibGitIndex index_{ nullptr, git_index_free };
+
+    /// Keep index modifications in memory until write_index() is called.
+    bool defer_index_write_ = false;
+
+    /// True if the in-memory index has modifications which are not written to disk.
+    bool index_dirty_ = false;
+
+    /// True while an IndexTransaction is active on this repository.
+    bool index_transaction_active_ = false;
+
+    /// Result of a log() query which is reused as long as HEAD does not move.
+    struct LogCacheEntry
+    {
+        Oid head;
+        std::size_t limit;
+        std::vector<CommitInfo> commits;
+    };
+
+    /// Cached log() results by path.
+    std::unordered_map<std::string, LogCacheEntry> log_cache_;
+
+    /// Cached ahead_behind() results by (local, upstream) commit ID.
+    std::map<std::pair<Oid, Oid>, AheadBehind> ahead_behind_cache_;
+
+    /// Create a new repository (used by create()).
+    Repository(const std::filesystem::path& file_path, const InitOptions& options);
+
+    /// Clone a repository (used by clone()).
+    Repository(const std::string& url, const std::filesystem::path& file_path,
+        const CloneOptions& options);
+
     /**
-     * Initialize a new git repository and commit all files in its path.
+     * Open the git repository or initialize a new one according to open_mode_.
      * \note This is a private member function because git repository init
      *       should be done by an LibGit Object Initialization
      */
@@ -372,34 +1102,74 @@ private:
     LibGitCommit get_commit(const std::string& ref);
 
     /**
-     * Load a git signature or create a default signature.
+     * Look up a commit through the object cache.
+     * \exception Error is thrown if the commit does not exist.
+     */
+    LibGitCommit lookup_commit(const git_oid& id);
+
+    /**
+     * Look up a tree through the object cache.
+     * \exception Error is thrown if the tree does not exist.
      */
-    void make_signature();
+    LibGitTree lookup_tree(const git_oid& id);
+
+    /**
+     * Return the tree a revision refers to, or null if the revision is an empty string.
+     * \exception Error is thrown if the revision does not exist or has no tree.
+     */
+    LibGitTree resolve_tree(const std::string& revision);
+
+    /**
+     * Return the ID of the commit a revision refers to.
+     * \exception Error is thrown if the revision does not exist or is not a commit.
+     */
+    git_oid resolve_commit(const std::string& revision);
+
+    /**
+     * Return the signature used in commits.
+     *
+     * It is loaded from the git configuration on first use; if none is configured, a
+     * default signature is created.
+     */
+    const git_signature* get_signature();
+
+    /**
+     * Return the cached index of the repository, loading it if necessary.
+     * \exception Error is thrown if the index cannot be loaded.
+     */
+    git_index* get_index();
+
+    /**
+     * Record that the index was modified: It is written to disk immediately unless
+     * deferred index writing is enabled.
+     */
+    void index_modified();
+
+    /// Write the cached index to disk unconditionally.
+    void write_index_to_disk();
+
+    /// Drop the cached index and discard modifications which have not been written.
+    void invalidate_index() noexcept;
 
     /**
-     * Translate all status information for each submodule into String.
-     * \param status C-type status of all submodules from libgit
+     * Translate all status information for each file into strings.
+     * \param status C-type status of all files from libgit
      * \return A vector of dynamic length which contains a status struct
      */
     RepoState collect_status(LibGitStatusList& status) const;
 
     /**
-     * Check if the file from the status entry is not staged and collect the status in filestats.
-     * \note this function is solely called by collect_status. It has no other purpose.
-     * \param filestats a structure which will be filled with the status of the file if the file is unstaged
-     * \param s status of the file. A struct which contains flags about every possible state
-     * \return true if file is unstaged (and filestats initialized), else false
+     * Translate all status information for each file into compact status structs.
+     * \param status C-type status of all files from libgit
+     * \return A vector of dynamic length which contains a compact status struct
      */
-    static bool is_unstaged(FileStatus& filestats, const git_status_entry* s);
+    CompactRepoState collect_compact_status(LibGitStatusList& status) const;
 
     /**
-     * Check if the file from the status entry is not unstaged and collect the status in filestats.
-     * \note this function is solely called by collect_status. It has no other purpose.
-     * \param filestats a structure which will be filled with the status of the file if the file is staged
-     * \param s status of the file. A struct which contains flags about every possible state
-     * \return true if file is staged (and filestats initialized), else false
+     * Create a libgit2 status list according to the given options.
+     * \exception Error is thrown if the status list cannot be created.
      */
-    static bool is_staged(FileStatus& filestats, const git_status_entry* s);
+    LibGitStatusList make_status_list(const StatusOptions& options);
 
 };
 
@@ -0,0 +1,179 @@
+/**
+ * \file   StatusList.h
+ * \date   Created on October 16, 2026
+ * \brief  Declaration of the StatusList class.
+ *
+ * \copyright Copyright 2026 Deutsches Elektronen-Synchrotron (DESY), Hamburg
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation, either version 2.1 of the license, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#ifndef LIBGIT4CPP_STATUSLIST_H_
+#define LIBGIT4CPP_STATUSLIST_H_
+
+#include <cstddef>
+#include <iterator>
+#include <string_view>
+
+#include <git2.h>
+
+#include "libgit4cpp/FileStatus.h"
+#include "libgit4cpp/types.h"
+
+namespace git {
+
+/**
+ * Non-owning view of the git status of one file.
+ *
+ * The paths point into the StatusList from which the view was obtained and are only
+ * valid as long as that list exists.
+ */
+struct FileStatusView
+{
+    /// Relative path to the file (the new path if the file was renamed).
+    std::string_view path_name;
+    /// Previous relative path if the file was renamed, otherwise empty.
+    std::string_view old_path_name;
+    /// Handling status of file
+    Handling handling = Handling::unchanged;
+    /// Change status of file
+    Change changes = Change::unchanged;
+
+    /// Convert the view into an owning CompactFileStatus.
+    CompactFileStatus to_compact_file_status() const;
+
+    /// Convert the view into an owning FileStatus.
+    FileStatus to_file_status() const;
+};
+
+/**
+ * A range over the git status of the files in a repository.
+ *
+ * A StatusList owns the libgit2 status list and decodes the status of a file only when
+ * the iterator reaches it. No strings are copied, so counting the entries or stopping
+ * at the first modified file does not allocate memory per file:
+ *
+ * \code{.cpp}
+ * for (auto entry : repo.status_view())
+ * {
+ *     if (entry.handling != Handling::unchanged)
+ *         std::cout << entry.path_name << " needs attention\n";
+ * }
+ * \endcode
+ *
+ * A StatusList must not outlive the Repository it was obtained from.
+ */
+class StatusList
+{
+public:
+    /// Forward iterator over the entries of a StatusList yielding FileStatusView objects.
+    class const_iterator
+    {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = FileStatusView;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const FileStatusView*;
+        using reference = const FileStatusView&;
+
+        const_iterator() = default;
+
+        reference operator*() const { return view_; }
+        pointer operator->() const { return &view_; }
+
+        const_iterator& operator++()
+        {
+            ++index_;
+            skip_to_valid();
+            return *this;
+        }
+
+        const_iterator operator++(int)
+        {
+            auto old = *this;
+            ++*this;
+            return old;
+        }
+
+        friend bool operator==(const const_iterator& a, const const_iterator& b)
+        {
+            return a.index_ == b.index_;
+        }
+
+        friend bool operator!=(const const_iterator& a, const const_iterator& b)
+        {
+            return a.index_ != b.index_;
+        }
+
+    private:
+        friend class StatusList;
+
+        git_status_list* list_{ nullptr };
+        std::size_t index_{ 0 };
+        std::size_t size_{ 0 };
+        FileStatusView view_;
+
+        const_iterator(git_status_list* list, std::size_t index, std::size_t size)
+            : list_{ list }, index_{ index }, size_{ size }
+        {
+            skip_to_valid();
+        }
+
+        /// Advance to the next entry that can be decoded and update the view.
+        void skip_to_valid();
+    };
+
+    using iterator = const_iterator;
+
+    /**
+     * Construct a StatusList by taking the ownership of a git_status_list unique pointer.
+     * \exception Error is thrown if the given pointer is null.
+     */
+    explicit StatusList(LibGitStatusList&& status_list);
+
+    /// Return an iterator to the first entry.
+    const_iterator begin() const;
+
+    /// Return an iterator past the last entry.
+    const_iterator end() const;
+
+    /**
+     * Return the number of entries visited by iterating from begin() to end().
+     *
+     * Entries of the underlying libgit2 status list whose state has no representation
+     * (e.g. merge conflicts) are skipped and not counted. This is an O(1) operation.
+     */
+    std::size_t size() const noexcept { return num_entries_; }
+
+    /// Determine if the status list has no entries, i.e. if begin() == end().
+    bool empty() const noexcept { return num_entries_ == 0; }
+
+    /// Return a non-owning pointer to the underlying git status list.
+    git_status_list* get() const noexcept { return list_.get(); }
+
+private:
+    LibGitStatusList list_{ nullptr, git_status_list_free };
+    /// Number of entries in the libgit2 status list, including undecodable ones.
+    std::size_t size_{ 0 };
+    /// Number of entries which can be decoded.
+    std::size_t num_entries_{ 0 };
+};
+
+} // namespace git
+
+#endif
+
+// vi:ts=4:sw=4:sts=4:et
@@ -0,0 +1,174 @@
+/**
+ * \file   SyncScheduler.h
+ * \date   Created on October 16, 2026
+ * \brief  Declaration of the SyncScheduler class.
+ *
+ * \copyright Copyright 2026 Deutsches Elektronen-Synchrotron (DESY), Hamburg
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation, either version 2.1 of the license, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#ifndef LIBGIT4CPP_SYNCSCHEDULER_H_
+#define LIBGIT4CPP_SYNCSCHEDULER_H_
+
+#include <chrono>
+#include <cstddef>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+namespace git {
+
+/// Direction of a SyncJob.
+enum class SyncDirection { fetch, push };
+
+/// A single fetch or push operation to be run by a SyncScheduler.
+struct SyncJob
+{
+    /// Path of the local repository.
+    std::filesystem::path repository;
+    /// Name of the configured remote to sync with.
+    std::string remote = "origin";
+    /// Refspecs to transfer (empty: use the refspecs configured for the remote).
+    std::vector<std::string> refspecs;
+    /// Whether to fetch from or to push to the remote.
+    SyncDirection direction = SyncDirection::fetch;
+};
+
+/// Outcome of a single SyncJob.
+struct SyncResult
+{
+    /// True if the job finished without error.
+    bool success = false;
+    /// True if the job was cancelled because it exceeded the timeout.
+    bool timed_out = false;
+    /// Error message if the job failed.
+    std::string error;
+    /// Number of objects received (fetch) or sent (push).
+    std::size_t objects = 0;
+    /// Number of bytes received (fetch) or sent (push).
+    std::size_t bytes = 0;
+    /// Time spent on the job, including opening the repository.
+    std::chrono::steady_clock::duration duration{ };
+
+    /// Return the transfer rate of this job in bytes per second.
+    double bytes_per_second() const noexcept
+    {
+        const auto seconds = std::chrono::duration<double>(duration).count();
+        return seconds > 0.0 ? bytes / seconds : 0.0;
+    }
+};
+
+/// Outcome of SyncScheduler::run().
+struct SyncReport
+{
+    /// One result per job, in the order in which the jobs were added.
+    std::vector<SyncResult> results;
+    /// Number of jobs that failed (including those that timed out).
+    std::size_t num_failed = 0;
+    /// Number of jobs that were cancelled because they exceeded the timeout.
+    std::size_t num_timed_out = 0;
+    /// Total number of bytes transferred by all jobs.
+    std::size_t bytes = 0;
+    /// Wall-clock time spent in run().
+    std::chrono::steady_clock::duration wall_time{ };
+
+    /// Return the aggregate transfer rate of all jobs in bytes per second.
+    double bytes_per_second() const noexcept
+    {
+        const auto seconds = std::chrono::duration<double>(wall_time).count();
+        return seconds > 0.0 ? bytes / seconds : 0.0;
+    }
+};
+
+/**
+ * Run fetch and push operations on many repositories in parallel.
+ *
+ * Jobs are added with add_job() and executed by run() on a bounded number of worker
+ * threads. libgit2 objects must not be shared between threads, so every job opens its
+ * own Repository. Jobs for the same repository path are therefore independent of each
+ * other; adding several pushes to the same remote ref is not recommended.
+ *
+ * \code{.cpp}
+ * SyncScheduler scheduler{ 16 };
+ * scheduler.set_timeout(std::chrono::minutes{ 2 });
+ * for (const auto& path : repository_paths)
+ * {
+ *     scheduler.add_job(SyncJob{ path, "origin" });
+ *     scheduler.add_job(SyncJob{ path, "backup", { }, SyncDirection::push });
+ * }
+ * auto report = scheduler.run();
+ * \endcode
+ */
+class SyncScheduler
+{
+public:
+    /**
+     * Construct a scheduler without any jobs.
+     * \param num_threads  Maximum number of worker threads (0: number of CPUs)
+     */
+    explicit SyncScheduler(unsigned int num_threads = 0);
+
+    /// Add a job to be executed by the next call to run().
+    void add_job(SyncJob job);
+
+    /// Remove all jobs.
+    void clear() noexcept { jobs_.clear(); }
+
+    /// Return the list of jobs.
+    const std::vector<SyncJob>& jobs() const noexcept { return jobs_; }
+
+    /// Return the maximum number of worker threads.
+    unsigned int num_threads() const noexcept { return num_threads_; }
+
+    /**
+     * Set the maximum time a single job may take (zero: no limit, the default).
+     *
+     * The limit is checked whenever libgit2 reports transfer progress. A job that
+     * exceeds it is cancelled and reported with SyncResult::timed_out set.
+     *
+     * \note Connecting to the remote and negotiating the transfer report no progress,
+     *       so a job that stalls in these phases is not cancelled. Such hangs must be
+     *       bounded by the transport, e.g. with the process-wide
+     *       GIT_OPT_SET_SERVER_TIMEOUT option of libgit2 1.7 or newer.
+     */
+    void set_timeout(std::chrono::steady_clock::duration timeout) noexcept
+    {
+        timeout_ = timeout;
+    }
+
+    /// Return the maximum time a single job may take (zero: no limit).
+    std::chrono::steady_clock::duration timeout() const noexcept { return timeout_; }
+
+    /**
+     * Execute all jobs and wait until they have finished.
+     *
+     * Errors are not thrown but reported in the results of the individual jobs. The
+     * jobs are kept, so run() can be called again for the next synchronization round.
+     */
+    SyncReport run() const;
+
+private:
+    std::vector<SyncJob> jobs_;
+    unsigned int num_threads_;
+    std::chrono::steady_clock::duration timeout_{ };
+};
+
+} // namespace git
+
+#endif
+
+// vi:ts=4:sw=4:sts=4:et
@@ -0,0 +1,150 @@
+/**
+ * \file   TreeBuilder.h
+ * \date   Created on October 16, 2026
+ * \brief  Declaration of the TreeBuilder class.
+ *
+ * \copyright Copyright 2026 Deutsches Elektronen-Synchrotron (DESY), Hamburg
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation, either version 2.1 of the license, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#ifndef LIBGIT4CPP_TREEBUILDER_H_
+#define LIBGIT4CPP_TREEBUILDER_H_
+
+#include <map>
+#include <string>
+#include <string_view>
+#include <utility>
+
+#include <git2.h>
+
+#include "libgit4cpp/Repository.h"
+#include "libgit4cpp/types.h"
+
+namespace git {
+
+/**
+ * Build a new tree from an existing one and commit it without using the index or the
+ * working directory.
+ *
+ * The builder starts from the tree of a base revision (or from an empty tree). Files can
+ * be inserted, replaced or removed by their path relative to the repository root;
+ * intermediate directories are created and removed as needed. The contents of inserted
+ * files are stored as blobs right away, the trees are only written by write() or
+ * commit().
+ *
+ * Because neither the index nor the working directory is involved, this also works for
+ * bare repositories, and several builders can prepare commits for different branches
+ * at the same time (each thread using its own Repository object).
+ *
+ * \code{.cpp}
+ * TreeBuilder builder{ repo, "refs/heads/main" };
+ * builder.insert("sequences/step_001.lua", step_code);
+ * builder.remove("sequences/obsolete.lua");
+ * builder.commit("refs/heads/main", "Update sequence");
+ * \endcode
+ */
+class TreeBuilder
+{
+public:
+    /**
+     * Create a tree builder based on the tree of the given revision.
+     * \param repo           The repository to operate on. It must outlive the builder.
+     * \param base_revision  Revision whose tree is used as a starting point (e.g. "HEAD",
+     *                       "refs/heads/main", or a commit ID). If empty, the builder
+     *                       starts with an empty tree.
+     * \exception Error is thrown if the revision cannot be resolved to a tree.
+     */
+    explicit TreeBuilder(Repository& repo, const std::string& base_revision = "");
+
+    /**
+     * Insert or replace a file.
+     *
+     * Modifications take effect in the order of the calls. A file inserted at the path
+     * of an existing directory replaces it. A file below an existing file, however, is
+     * only accepted if that file is removed first.
+     *
+     * \param path     Path of the file relative to the repository root (e.g. "a/b.txt")
+     * \param content  Content of the file
+     * \param mode     File mode (normal or executable file, link)
+     * \exception Error is thrown if the path is invalid, if it conflicts with a file or
+     *            directory inserted earlier (e.g. "a/b" after "a"), or if the blob cannot
+     *            be created. write() and commit() throw if a file would be placed below
+     *            a file of the base tree.
+     */
+    void insert(const std::string& path, std::string_view content,
+        git_filemode_t mode = GIT_FILEMODE_BLOB);
+
+    /**
+     * Remove a file or a whole directory, including files inserted into it earlier.
+     * Removing a path that does not exist has no effect.
+     * \param path  Path relative to the repository root
+     * \exception Error is thrown if the path is invalid.
+     */
+    void remove(const std::string& path);
+
+    /**
+     * Write all trees to the object database.
+     * \return the ID of the new root tree.
+     * \exception Error is thrown if a tree cannot be written.
+     */
+    git_oid write();
+
+    /**
+     * Write the tree and commit it to the given reference.
+     *
+     * The current target of the reference becomes the parent of the new commit; if the
+     * reference does not exist yet, the commit has no parent. Neither the index nor the
+     * working directory is touched, even if the reference is the checked-out branch.
+     *
+     * \param ref      Full name of the reference to update (e.g. "refs/heads/main" or
+     *                 "HEAD")
+     * \param message  Commit message
+     * \return the ID of the new commit.
+     * \exception Error is thrown if the commit cannot be created, e.g. because the
+     *            reference was updated concurrently.
+     */
+    git_oid commit(const std::string& ref, const std::string& message);
+
+private:
+    /// A pending modification of one path.
+    struct Modification
+    {
+        bool remove = false;
+        git_oid id{ };
+        git_filemode_t mode = GIT_FILEMODE_BLOB;
+    };
+
+    using Modifications = std::map<std::string, Modification>;
+
+    Repository& repo_;
+    LibGitTree base_tree_{ nullptr, git_tree_free };
+    Modifications modifications_;
+
+    /// Return the range of pending modifications strictly below a directory path.
+    std::pair<Modifications::iterator, Modifications::iterator>
+    find_below(const std::string& path);
+
+    /// Build the tree for the modifications in [begin, end) which all share a prefix.
+    git_oid build_tree(const git_tree* base, Modifications::const_iterator begin,
+        Modifications::const_iterator end, std::size_t prefix_len, bool& is_empty);
+};
+
+} // namespace git
+
+#endif
+
+// vi:ts=4:sw=4:sts=4:et
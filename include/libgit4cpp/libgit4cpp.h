@@ -25,8 +25,19 @@
 #ifndef LIBGIT4CPP_LIBGIT4CPP_H_
 #define LIBGIT4CPP_LIBGIT4CPP_H_
 
+#include "libgit4cpp/BlobView.h"
+#include "libgit4cpp/CommitRange.h"
+#include "libgit4cpp/Diff.h"
 #include "libgit4cpp/Error.h"
+#include "libgit4cpp/FileStatus.h"
+#include "libgit4cpp/IndexTransaction.h"
+#include "libgit4cpp/Library.h"
+#include "libgit4cpp/ObjectCache.h"
+#include "libgit4cpp/Oid.h"
 #include "libgit4cpp/Repository.h"
+#include "libgit4cpp/StatusList.h"
+#include "libgit4cpp/SyncScheduler.h"
+#include "libgit4cpp/TreeBuilder.h"
 #include "libgit4cpp/types.h"
 #include "libgit4cpp/wrapper_functions.h"
 
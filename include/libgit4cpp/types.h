@@ -40,6 +40,12 @@ using LibGitStatusList = std::unique_ptr<git_status_list, void(*)(git_status_lis
 using LibGitReference = std::unique_ptr<git_reference, void(*)(git_reference*)>;
 using LibGitBuf = std::unique_ptr<git_buf, void(*)(git_buf*)>;
 using LibGitBranchIterator = std::unique_ptr<git_branch_iterator, void(*)(git_branch_iterator*)>;
+using LibGitObject = std::unique_ptr<git_object, void(*)(git_object*)>;
+using LibGitTreeBuilder = std::unique_ptr<git_treebuilder, void(*)(git_treebuilder*)>;
+using LibGitTreeEntry = std::unique_ptr<git_tree_entry, void(*)(git_tree_entry*)>;
+using LibGitRevwalk = std::unique_ptr<git_revwalk, void(*)(git_revwalk*)>;
+using LibGitDiff = std::unique_ptr<git_diff, void(*)(git_diff*)>;
+using LibGitBlob = std::unique_ptr<git_blob, void(*)(git_blob*)>;
 
 } // namespace git
 
@@ -46,6 +46,9 @@ namespace git {
 
 /**
  * Open an existing repository.
+ *
+ * Parent directories are not searched for a repository.
+ *
  * \param repo_path Absolute or relative path to the repository root
  * \return new git_repository object for the opened repository
 */
@@ -55,9 +58,11 @@ LibGitRepository repository_open(const std::string& repo_path);
  * Initialize a fresh repository.
  * \param repo_path Absolute or relative path to the repository root
  * \param is_bare If true, a git repo is created at repo_path. Else, .git is created in repo_path.
+ * \param initial_head Name of the branch HEAD points to
  * \return new git_repository object for the created repository
  */
-LibGitRepository repository_init(const std::string& repo_path, bool is_bare);
+LibGitRepository repository_init(const std::string& repo_path, bool is_bare,
+    const std::string& initial_head = "main");
 
 /**
  * Return the current index of a repository.
@@ -132,9 +137,11 @@ LibGitRemote remote_lookup(git_repository* repo, const std::string& remote_name)
  * Clone an existing git repository into the local filesystem.
  * \param url Address of remote connection, e.g https://github.com/...
  * \param repo_path Absolute or relative path to the repository root
- * \return new git_repository object
+ * \param options Clone options (null for libgit2's defaults)
+ * \return new git_repository object (null if the clone failed)
  */
-LibGitRepository clone(const std::string& url, const std::string& repo_path);
+LibGitRepository clone(const std::string& url, const std::string& repo_path,
+    const git_clone_options* options = nullptr);
 
 /**
  * Find a named branch.
@@ -213,6 +220,29 @@ LibGitBranchIterator branch_iterator(git_repository* repo, git_branch_t flag);
  */
 LibGitReference branch_next(git_branch_t* branch_type, git_branch_iterator* iter);
 
+/**
+ * Find an object from a revision specification.
+ * \param repo Pointer to repository object
+ * \param spec revision specification (eg. HEAD, main, e934a2, HEAD~2, main:path/file)
+ * \return object found (null if not found)
+ */
+LibGitObject revparse_single(git_repository* repo, const std::string& spec);
+
+/**
+ * Create a tree builder for building a new tree object.
+ * \param repo Pointer to repository object
+ * \param source Tree to initialize the builder with (may be null for an empty tree)
+ * \return tree builder object (null on error)
+ */
+LibGitTreeBuilder treebuilder_new(git_repository* repo, const git_tree* source);
+
+/**
+ * Create a revision walker for traversing the commit history.
+ * \param repo Pointer to repository object
+ * \return revision walker object (null on error)
+ */
+LibGitRevwalk revwalk_new(git_repository* repo);
+
 /** \} */ // end of group lgptrfunc
 
 } // namespace git
@@ -0,0 +1,59 @@
+/**
+ * \file   BlobView.cc
+ * \date   Created on October 16, 2026
+ * \brief  Implementation of the BlobView class.
+ *
+ * \copyright Copyright 2026 Deutsches Elektronen-Synchrotron (DESY), Hamburg
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation, either version 2.1 of the license, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <git2.h>
+
+#include "libgit4cpp/BlobView.h"
+#include "libgit4cpp/Error.h"
+
+namespace git {
+
+BlobView::BlobView(LibGitBlob&& blob)
+    : blob_{ std::move(blob) }
+{
+    if (blob_ == nullptr)
+        throw Error{ "Blob pointer may not be null" };
+}
+
+std::string_view BlobView::content() const noexcept
+{
+    return std::string_view{ static_cast<const char*>(git_blob_rawcontent(blob_.get())),
+        size() };
+}
+
+std::size_t BlobView::size() const noexcept
+{
+    return static_cast<std::size_t>(git_blob_rawsize(blob_.get()));
+}
+
+const git_oid& BlobView::id() const noexcept
+{
+    return *git_blob_id(blob_.get());
+}
+
+bool BlobView::is_binary() const noexcept
+{
+    return git_blob_is_binary(blob_.get()) != 0;
+}
+
+} // namespace git
@@ -0,0 +1,195 @@
+/**
+ * \file   CommitRange.cc
+ * \date   Created on October 16, 2026
+ * \brief  Implementation of the CommitRange class.
+ *
+ * \copyright Copyright 2026 Deutsches Elektronen-Synchrotron (DESY), Hamburg
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation, either version 2.1 of the license, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <git2.h>
+#include <gul14/cat.h>
+
+#include "libgit4cpp/CommitRange.h"
+#include "libgit4cpp/Error.h"
+#include "libgit4cpp/wrapper_functions.h"
+
+using gul14::cat;
+
+namespace git {
+
+namespace {
+
+/// Push or hide the commit a revision specification refers to.
+void add_revision(git_revwalk* walk, git_repository* repo, const std::string& spec,
+    bool hide)
+{
+    if (not hide && spec.find("..") != std::string::npos)
+    {
+        int error = git_revwalk_push_range(walk, spec.c_str());
+        if (error)
+        {
+            throw Error{ error, cat("Cannot walk revision range \"", spec, "\": ",
+                git_error_last()->message) };
+        }
+        return;
+    }
+
+    auto object = revparse_single(repo, spec);
+    if (not object)
+        throw Error{ cat("Cannot find revision \"", spec, "\": ", git_error_last()->message) };
+
+    git_object* commit;
+    int error = git_object_peel(&commit, object.get(), GIT_OBJECT_COMMIT);
+    if (error)
+        throw Error{ error, cat("Revision \"", spec, "\" is not a commit") };
+    LibGitObject commit_owner{ commit, git_object_free };
+
+    error = hide ? git_revwalk_hide(walk, git_object_id(commit))
+                 : git_revwalk_push(walk, git_object_id(commit));
+    if (error)
+        throw Error{ error, cat("Cannot walk revision \"", spec, "\": ", git_error_last()->message) };
+}
+
+} // anonymous namespace
+
+std::string CommitView::id_string() const
+{
+    char buf[GIT_OID_HEXSZ + 1];
+    git_oid_tostr(buf, sizeof(buf), &id_);
+    return buf;
+}
+
+git_commit* CommitView::get() const
+{
+    if (not commit_)
+    {
+        git_commit* commit;
+        int error = git_commit_lookup(&commit, repo_, &id_);
+        if (error)
+            throw Error{ error, cat("Cannot find commit ", id_string()) };
+        commit_.reset(commit);
+    }
+    return commit_.get();
+}
+
+std::string_view CommitView::message() const
+{
+    const char* msg = git_commit_message(get());
+    return msg ? msg : "";
+}
+
+std::string_view CommitView::summary() const
+{
+    const char* summary = git_commit_summary(get());
+    return summary ? summary : "";
+}
+
+std::string_view CommitView::author_name() const
+{
+    return git_commit_author(get())->name;
+}
+
+std::string_view CommitView::author_email() const
+{
+    return git_commit_author(get())->email;
+}
+
+std::int64_t CommitView::time() const
+{
+    return git_commit_time(get());
+}
+
+int CommitView::time_offset() const
+{
+    return git_commit_time_offset(get());
+}
+
+unsigned int CommitView::parent_count() const
+{
+    return git_commit_parentcount(get());
+}
+
+CommitInfo CommitView::to_commit_info() const
+{
+    CommitInfo info;
+    info.id = id_string();
+    info.summary = summary();
+    info.message = message();
+    info.author_name = author_name();
+    info.author_email = author_email();
+    info.time = time();
+    return info;
+}
+
+CommitRange::CommitRange(git_repository* repo, const CommitRangeOptions& options)
+    : walk_{ revwalk_new(repo) }
+{
+    if (not walk_)
+        throw Error{ cat("Cannot create revision walker: ", git_error_last()->message) };
+
+    view_.repo_ = repo;
+
+    unsigned int sorting = GIT_SORT_NONE;
+    if (options.topological)
+        sorting |= GIT_SORT_TOPOLOGICAL;
+    if (options.time)
+        sorting |= GIT_SORT_TIME;
+    if (options.reverse)
+        sorting |= GIT_SORT_REVERSE;
+    git_revwalk_sorting(walk_.get(), sorting);
+
+    if (options.first_parent_only)
+        git_revwalk_simplify_first_parent(walk_.get());
+
+    for (const auto& spec : options.push)
+        add_revision(walk_.get(), repo, spec, false);
+    for (const auto& spec : options.hide)
+        add_revision(walk_.get(), repo, spec, true);
+}
+
+CommitRange::const_iterator CommitRange::begin()
+{
+    if (not started_)
+    {
+        started_ = true;
+        return const_iterator{ this, next() };
+    }
+
+    return const_iterator{ this, done_ ? nullptr : &view_ };
+}
+
+const CommitView* CommitRange::next()
+{
+    if (done_)
+        return nullptr;
+
+    view_.commit_.reset();
+
+    int error = git_revwalk_next(&view_.id_, walk_.get());
+    if (error == GIT_ITEROVER)
+    {
+        done_ = true;
+        return nullptr;
+    }
+    if (error)
+        throw Error{ error, cat("Cannot walk history: ", git_error_last()->message) };
+
+    return &view_;
+}
+
+} // namespace git
@@ -0,0 +1,272 @@
+/**
+ * \file   Diff.cc
+ * \date   Created on October 16, 2026
+ * \brief  Implementation of the Diff class.
+ *
+ * \copyright Copyright 2026 Deutsches Elektronen-Synchrotron (DESY), Hamburg
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation, either version 2.1 of the license, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <exception>
+
+#include <git2.h>
+#include <gul14/cat.h>
+
+#include "libgit4cpp/Diff.h"
+#include "libgit4cpp/Error.h"
+
+using gul14::cat;
+
+namespace git {
+
+namespace {
+
+/// Options in libgit2 format; the pathspec points into the DiffOptions object.
+struct GitDiffOptions
+{
+    git_diff_options opts = GIT_DIFF_OPTIONS_INIT;
+    std::vector<const char*> pathspec;
+
+    explicit GitDiffOptions(const DiffOptions& options)
+    {
+        if (options.pathspec_literal)
+            opts.flags |= GIT_DIFF_DISABLE_PATHSPEC_MATCH;
+        if (options.skip_binary_check)
+            opts.flags |= GIT_DIFF_SKIP_BINARY_CHECK;
+        if (options.include_untracked)
+            opts.flags |= GIT_DIFF_INCLUDE_UNTRACKED | GIT_DIFF_RECURSE_UNTRACKED_DIRS;
+        if (options.ignore_whitespace)
+            opts.flags |= GIT_DIFF_IGNORE_WHITESPACE;
+        opts.context_lines = options.context_lines;
+
+        pathspec.reserve(options.pathspec.size());
+        for (const auto& path : options.pathspec)
+            pathspec.push_back(path.c_str());
+        opts.pathspec.strings = const_cast<char**>(pathspec.data());
+        opts.pathspec.count = pathspec.size();
+    }
+};
+
+Change to_change(git_delta_t status) noexcept
+{
+    switch (status)
+    {
+    case GIT_DELTA_UNMODIFIED: return Change::unchanged;
+    case GIT_DELTA_ADDED: return Change::new_file;
+    case GIT_DELTA_COPIED: return Change::new_file;
+    case GIT_DELTA_DELETED: return Change::deleted;
+    case GIT_DELTA_RENAMED: return Change::renamed;
+    case GIT_DELTA_TYPECHANGE: return Change::typechange;
+    case GIT_DELTA_UNTRACKED: return Change::untracked;
+    case GIT_DELTA_IGNORED: return Change::ignored;
+    default: return Change::modified;
+    }
+}
+
+DiffDelta to_delta(const git_diff_delta* delta) noexcept
+{
+    DiffDelta result;
+    result.old_path = delta->old_file.path ? delta->old_file.path : "";
+    result.new_path = delta->new_file.path ? delta->new_file.path : "";
+    result.change = to_change(delta->status);
+    result.old_id = delta->old_file.id;
+    result.new_id = delta->new_file.id;
+    result.binary = (delta->flags & GIT_DIFF_FLAG_BINARY) != 0;
+    return result;
+}
+
+DiffHunk to_hunk(const git_diff_hunk* hunk) noexcept
+{
+    DiffHunk result;
+    if (hunk)
+    {
+        result.header = std::string_view{ hunk->header, hunk->header_len };
+        result.old_start = hunk->old_start;
+        result.old_lines = hunk->old_lines;
+        result.new_start = hunk->new_start;
+        result.new_lines = hunk->new_lines;
+    }
+    return result;
+}
+
+/// State passed through git_diff_foreach() to the C callbacks.
+struct ForEachPayload
+{
+    const Diff::FileCallback& file_cb;
+    const Diff::HunkCallback& hunk_cb;
+    const Diff::LineCallback& line_cb;
+    DiffDelta delta;
+    std::exception_ptr exception;
+};
+
+int file_callback(const git_diff_delta* delta, float, void* payload)
+{
+    auto& state = *static_cast<ForEachPayload*>(payload);
+    try
+    {
+        state.delta = to_delta(delta);
+        if (state.file_cb && not state.file_cb(state.delta))
+            return 1;
+    }
+    catch (...)
+    {
+        state.exception = std::current_exception();
+        return 1;
+    }
+    return 0;
+}
+
+int hunk_callback(const git_diff_delta*, const git_diff_hunk* hunk, void* payload)
+{
+    auto& state = *static_cast<ForEachPayload*>(payload);
+    try
+    {
+        if (not state.hunk_cb(state.delta, to_hunk(hunk)))
+            return 1;
+    }
+    catch (...)
+    {
+        state.exception = std::current_exception();
+        return 1;
+    }
+    return 0;
+}
+
+int line_callback(const git_diff_delta*, const git_diff_hunk* hunk,
+    const git_diff_line* line, void* payload)
+{
+    auto& state = *static_cast<ForEachPayload*>(payload);
+    try
+    {
+        DiffLine result;
+        result.origin = line->origin;
+        result.content = std::string_view{ line->content, line->content_len };
+        result.old_lineno = line->old_lineno;
+        result.new_lineno = line->new_lineno;
+
+        if (not state.line_cb(state.delta, to_hunk(hunk), result))
+            return 1;
+    }
+    catch (...)
+    {
+        state.exception = std::current_exception();
+        return 1;
+    }
+    return 0;
+}
+
+/// Throw an Error if creating a diff failed, otherwise return a Diff object.
+Diff make_diff(git_diff* diff, int error)
+{
+    if (error)
+        throw Error{ error, cat("Cannot calculate diff: ", git_error_last()->message) };
+    return Diff{ LibGitDiff{ diff, git_diff_free } };
+}
+
+} // anonymous namespace
+
+Diff::Diff(LibGitDiff&& diff)
+    : diff_{ std::move(diff) }
+{
+    if (diff_ == nullptr)
+        throw Error{ "Diff pointer may not be null" };
+}
+
+Diff Diff::tree_to_tree(git_repository* repo, git_tree* old_tree, git_tree* new_tree,
+    const DiffOptions& options)
+{
+    GitDiffOptions opts{ options };
+    git_diff* diff = nullptr;
+    int error = git_diff_tree_to_tree(&diff, repo, old_tree, new_tree, &opts.opts);
+    return make_diff(diff, error);
+}
+
+Diff Diff::tree_to_index(git_repository* repo, git_tree* old_tree, git_index* index,
+    const DiffOptions& options)
+{
+    GitDiffOptions opts{ options };
+    git_diff* diff = nullptr;
+    int error = git_diff_tree_to_index(&diff, repo, old_tree, index, &opts.opts);
+    return make_diff(diff, error);
+}
+
+Diff Diff::index_to_workdir(git_repository* repo, git_index* index,
+    const DiffOptions& options)
+{
+    GitDiffOptions opts{ options };
+    git_diff* diff = nullptr;
+    int error = git_diff_index_to_workdir(&diff, repo, index, &opts.opts);
+    return make_diff(diff, error);
+}
+
+std::size_t Diff::size() const noexcept
+{
+    return git_diff_num_deltas(diff_.get());
+}
+
+DiffDelta Diff::delta(std::size_t index) const
+{
+    const git_diff_delta* delta = git_diff_get_delta(diff_.get(), index);
+    if (delta == nullptr)
+        throw Error{ cat("Diff delta index out of range: ", index) };
+    return to_delta(delta);
+}
+
+std::vector<DiffDelta> Diff::deltas() const
+{
+    const std::size_t num = size();
+    std::vector<DiffDelta> result;
+    result.reserve(num);
+    for (std::size_t i = 0; i != num; ++i)
+        result.push_back(to_delta(git_diff_get_delta(diff_.get(), i)));
+    return result;
+}
+
+DiffStats Diff::stats() const
+{
+    git_diff_stats* raw_stats;
+    int error = git_diff_get_stats(&raw_stats, diff_.get());
+    if (error)
+        throw Error{ error, cat("Cannot calculate diff stats: ", git_error_last()->message) };
+
+    DiffStats stats;
+    stats.files_changed = git_diff_stats_files_changed(raw_stats);
+    stats.insertions = git_diff_stats_insertions(raw_stats);
+    stats.deletions = git_diff_stats_deletions(raw_stats);
+    git_diff_stats_free(raw_stats);
+    return stats;
+}
+
+bool Diff::for_each(const FileCallback& file_cb, const HunkCallback& hunk_cb,
+    const LineCallback& line_cb) const
+{
+    ForEachPayload payload{ file_cb, hunk_cb, line_cb, DiffDelta{ }, nullptr };
+
+    // The file callback is always needed to track the current delta
+    int error = git_diff_foreach(diff_.get(), file_callback, nullptr,
+        hunk_cb ? hunk_callback : nullptr, line_cb ? line_callback : nullptr, &payload);
+
+    if (payload.exception)
+        std::rethrow_exception(payload.exception);
+    if (error == 1 || error == GIT_EUSER)
+        return false;
+    if (error)
+        throw Error{ error, cat("Cannot iterate over diff: ", git_error_last()->message) };
+    return true;
+}
+
+} // namespace git
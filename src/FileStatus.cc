@@ -0,0 +1,167 @@
+/**
+ * \file   FileStatus.cc
+ * \date   Created on October 16, 2026
+ * \brief  Implementation of the file status types and the status entry decoder.
+ *
+ * \copyright Copyright 2023-2026 Deutsches Elektronen-Synchrotron (DESY), Hamburg
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation, either version 2.1 of the license, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <cstring>
+
+#include <git2.h>
+#include <gul14/cat.h>
+
+#include "libgit4cpp/FileStatus.h"
+#include "status_entry.h"
+
+using gul14::cat;
+
+namespace git {
+
+std::string_view to_string(Handling handling) noexcept
+{
+    switch (handling)
+    {
+        case Handling::unchanged: return "unchanged";
+        case Handling::unstaged: return "unstaged";
+        case Handling::staged: return "staged";
+        case Handling::untracked: return "untracked";
+        case Handling::ignored: return "ignored";
+    }
+    return "unknown";
+}
+
+std::string_view to_string(Change change) noexcept
+{
+    switch (change)
+    {
+        case Change::unchanged: return "unchanged";
+        case Change::new_file: return "new file";
+        case Change::modified: return "modified";
+        case Change::deleted: return "deleted";
+        case Change::renamed: return "renamed";
+        case Change::typechange: return "typechange";
+        case Change::untracked: return "untracked";
+        case Change::ignored: return "ignored";
+    }
+    return "unknown";
+}
+
+FileStatus to_file_status(const CompactFileStatus& status)
+{
+    return FileStatus{ status.path_name, std::string{ to_string(status.handling) },
+        std::string{ to_string(status.changes) } };
+}
+
+RepoState to_repo_state(const CompactRepoState& state)
+{
+    RepoState result;
+    result.reserve(state.size());
+    for (const auto& file_status : state)
+        result.push_back(to_file_status(file_status));
+    return result;
+}
+
+bool decode_status_entry(const git_status_entry* s, DecodedStatusEntry& out) noexcept
+{
+    // list files which exists but are untouched since last commit
+    if (s->status == GIT_STATUS_CURRENT)
+    {
+        out.handling = Handling::unchanged;
+        out.changes = Change::unchanged;
+        out.old_path = s->head_to_index->old_file.path;
+        out.new_path = s->head_to_index->new_file.path;
+        return true;
+    }
+
+    // list files which were touched but are not staged
+    if (s->status & (GIT_STATUS_WT_MODIFIED | GIT_STATUS_WT_DELETED
+                     | GIT_STATUS_WT_RENAMED | GIT_STATUS_WT_TYPECHANGE))
+    {
+        if (s->status & GIT_STATUS_WT_TYPECHANGE)
+            out.changes = Change::typechange;
+        else if (s->status & GIT_STATUS_WT_RENAMED)
+            out.changes = Change::renamed;
+        else if (s->status & GIT_STATUS_WT_DELETED)
+            out.changes = Change::deleted;
+        else
+            out.changes = Change::modified;
+
+        out.handling = Handling::unstaged;
+        out.old_path = s->index_to_workdir->old_file.path;
+        out.new_path = s->index_to_workdir->new_file.path;
+        return true;
+    }
+
+    // list files which are staged for next commit
+    if (s->status & (GIT_STATUS_INDEX_NEW | GIT_STATUS_INDEX_MODIFIED
+                     | GIT_STATUS_INDEX_DELETED | GIT_STATUS_INDEX_RENAMED
+                     | GIT_STATUS_INDEX_TYPECHANGE))
+    {
+        if (s->status & GIT_STATUS_INDEX_TYPECHANGE)
+            out.changes = Change::typechange;
+        else if (s->status & GIT_STATUS_INDEX_RENAMED)
+            out.changes = Change::renamed;
+        else if (s->status & GIT_STATUS_INDEX_DELETED)
+            out.changes = Change::deleted;
+        else if (s->status & GIT_STATUS_INDEX_MODIFIED)
+            out.changes = Change::modified;
+        else
+            out.changes = Change::new_file;
+
+        out.handling = Handling::staged;
+        out.old_path = s->head_to_index->old_file.path;
+        out.new_path = s->head_to_index->new_file.path;
+        return true;
+    }
+
+    // list untracked files
+    if (s->status == GIT_STATUS_WT_NEW)
+    {
+        out.handling = Handling::untracked;
+        out.changes = Change::untracked;
+        out.old_path = s->index_to_workdir->old_file.path;
+        out.new_path = nullptr;
+        return true;
+    }
+
+    // list ignored files
+    if (s->status == GIT_STATUS_IGNORED)
+    {
+        out.handling = Handling::ignored;
+        out.changes = Change::ignored;
+        out.old_path = s->index_to_workdir->old_file.path;
+        out.new_path = nullptr;
+        return true;
+    }
+
+    return false;
+}
+
+std::string format_path_name(const DecodedStatusEntry& entry)
+{
+    if (entry.old_path && entry.new_path && std::strcmp(entry.old_path, entry.new_path))
+        return cat(entry.old_path, " -> ", entry.new_path);
+
+    if (entry.old_path)
+        return entry.old_path;
+
+    return entry.new_path ? entry.new_path : "";
+}
+
+} // namespace git
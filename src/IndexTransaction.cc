@@ -0,0 +1,113 @@
+/**
+ * \file   IndexTransaction.cc
+ * \date   Created on October 16, 2026
+ * \brief  Implementation of the IndexTransaction class.
+ *
+ * \copyright Copyright 2026 Deutsches Elektronen-Synchrotron (DESY), Hamburg
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation, either version 2.1 of the license, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include "libgit4cpp/Error.h"
+#include "libgit4cpp/IndexTransaction.h"
+
+namespace git {
+
+IndexTransaction::IndexTransaction(Repository& repo)
+    : repo_{ repo }
+    , previously_deferred_{ repo.is_index_write_deferred() }
+{
+    if (repo_.index_transaction_active_)
+        throw Error{ "Another index transaction is already active on this repository" };
+
+    repo_.write_index();
+    repo_.defer_index_write_ = true;
+    repo_.index_transaction_active_ = true;
+}
+
+IndexTransaction::~IndexTransaction()
+{
+    rollback();
+}
+
+void IndexTransaction::check_active() const
+{
+    if (not active_)
+        throw Error{ "Index transaction is no longer active" };
+}
+
+void IndexTransaction::add(const std::string& glob)
+{
+    check_active();
+    repo_.add(glob);
+}
+
+void IndexTransaction::update(const std::string& glob)
+{
+    check_active();
+    repo_.update(glob);
+}
+
+std::vector<int> IndexTransaction::add_files(
+    const std::vector<std::filesystem::path>& filepaths)
+{
+    check_active();
+    return repo_.add_files(filepaths);
+}
+
+void IndexTransaction::stage_buffer(const std::filesystem::path& path,
+    std::string_view content, git_filemode_t mode)
+{
+    check_active();
+    repo_.stage_buffer(path, content, mode);
+}
+
+void IndexTransaction::remove_files(const std::vector<std::filesystem::path>& filepaths)
+{
+    check_active();
+    repo_.remove_files(filepaths);
+}
+
+void IndexTransaction::remove_directory(const std::filesystem::path& directory)
+{
+    check_active();
+    repo_.remove_directory(directory);
+}
+
+void IndexTransaction::write()
+{
+    check_active();
+    repo_.write_index();
+    finish();
+}
+
+void IndexTransaction::rollback() noexcept
+{
+    if (not active_)
+        return;
+
+    repo_.invalidate_index();
+    finish();
+}
+
+void IndexTransaction::finish() noexcept
+{
+    repo_.defer_index_write_ = previously_deferred_;
+    repo_.index_transaction_active_ = false;
+    active_ = false;
+}
+
+} // namespace git
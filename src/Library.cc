@@ -0,0 +1,145 @@
+/**
+ * \file   Library.cc
+ * \date   Created on October 16, 2026
+ * \brief  Implementation of the Library class and of the global options.
+ *
+ * \copyright Copyright 2026 Deutsches Elektronen-Synchrotron (DESY), Hamburg
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation, either version 2.1 of the license, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <git2.h>
+#include <gul14/cat.h>
+
+#include "libgit4cpp/Error.h"
+#include "libgit4cpp/Library.h"
+
+using gul14::cat;
+
+namespace git {
+
+namespace {
+
+/// Initializes libgit2 on construction and shuts it down on destruction.
+struct Initializer
+{
+    Initializer() { git_libgit2_init(); }
+    ~Initializer() { git_libgit2_shutdown(); }
+    Initializer(const Initializer&) = delete;
+    Initializer& operator=(const Initializer&) = delete;
+};
+
+/// Throw an Error if a call to git_libgit2_opts() failed.
+void check_option(int error, const char* option_name, const char* action = "set")
+{
+    if (error < 0)
+    {
+        const auto* last_error = git_error_last();
+        throw Error{ error, cat("Cannot ", action, ' ', option_name, ": ",
+            last_error ? last_error->message : "unknown error") };
+    }
+}
+
+/// Read a size_t option with git_libgit2_opts().
+std::size_t get_size_option(int option, const char* option_name)
+{
+    size_t value = 0;
+    check_option(git_libgit2_opts(option, &value), option_name, "get");
+    return value;
+}
+
+} // anonymous namespace
+
+Library::Library()
+{
+    // Thread-safe since C++11; destroyed at process exit
+    static Initializer initializer;
+}
+
+void set_global_options(const GlobalOptions& options)
+{
+    Library library;
+
+    if (options.caching)
+    {
+        check_option(git_libgit2_opts(GIT_OPT_ENABLE_CACHING, *options.caching ? 1 : 0),
+            "caching");
+    }
+    if (options.cache_max_size)
+    {
+        check_option(git_libgit2_opts(GIT_OPT_SET_CACHE_MAX_SIZE,
+            static_cast<ssize_t>(*options.cache_max_size)), "cache_max_size");
+    }
+    for (const auto& [type, limit] : options.cache_object_limits)
+    {
+        check_option(git_libgit2_opts(GIT_OPT_SET_CACHE_OBJECT_LIMIT, type,
+            static_cast<size_t>(limit)), "cache_object_limits");
+    }
+    if (options.mwindow_size)
+    {
+        check_option(git_libgit2_opts(GIT_OPT_SET_MWINDOW_SIZE,
+            static_cast<size_t>(*options.mwindow_size)), "mwindow_size");
+    }
+    if (options.mwindow_mapped_limit)
+    {
+        check_option(git_libgit2_opts(GIT_OPT_SET_MWINDOW_MAPPED_LIMIT,
+            static_cast<size_t>(*options.mwindow_mapped_limit)), "mwindow_mapped_limit");
+    }
+    if (options.mwindow_file_limit)
+    {
+#if LIBGIT2_FULLVERSION >= 1001000
+        check_option(git_libgit2_opts(GIT_OPT_SET_MWINDOW_FILE_LIMIT,
+            static_cast<size_t>(*options.mwindow_file_limit)), "mwindow_file_limit");
+#else
+        throw Error{ GIT_ERROR, "Cannot set mwindow_file_limit: Requires libgit2 1.1" };
+#endif
+    }
+    if (options.strict_object_creation)
+    {
+        check_option(git_libgit2_opts(GIT_OPT_ENABLE_STRICT_OBJECT_CREATION,
+            *options.strict_object_creation ? 1 : 0), "strict_object_creation");
+    }
+    if (options.strict_hash_verification)
+    {
+        check_option(git_libgit2_opts(GIT_OPT_ENABLE_STRICT_HASH_VERIFICATION,
+            *options.strict_hash_verification ? 1 : 0), "strict_hash_verification");
+    }
+}
+
+GlobalOptions get_global_options()
+{
+    Library library;
+    GlobalOptions options;
+
+    ssize_t current = 0;
+    ssize_t allowed = 0;
+    check_option(git_libgit2_opts(GIT_OPT_GET_CACHED_MEMORY, &current, &allowed),
+        "cached_memory", "get");
+    options.cached_memory = static_cast<std::size_t>(current);
+    options.cache_max_size = static_cast<std::size_t>(allowed);
+
+    options.mwindow_size = get_size_option(GIT_OPT_GET_MWINDOW_SIZE, "mwindow_size");
+    options.mwindow_mapped_limit = get_size_option(GIT_OPT_GET_MWINDOW_MAPPED_LIMIT,
+        "mwindow_mapped_limit");
+#if LIBGIT2_FULLVERSION >= 1001000
+    options.mwindow_file_limit = get_size_option(GIT_OPT_GET_MWINDOW_FILE_LIMIT,
+        "mwindow_file_limit");
+#endif
+
+    return options;
+}
+
+} // namespace git
@@ -0,0 +1,149 @@
+/**
+ * \file   ObjectCache.cc
+ * \date   Created on October 16, 2026
+ * \brief  Implementation of the ObjectCache class.
+ *
+ * \copyright Copyright 2026 Deutsches Elektronen-Synchrotron (DESY), Hamburg
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation, either version 2.1 of the license, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <cstring>
+
+#include <git2.h>
+#include <gul14/cat.h>
+
+#include "libgit4cpp/Error.h"
+#include "libgit4cpp/ObjectCache.h"
+
+using gul14::cat;
+
+namespace git {
+
+namespace {
+
+/// Estimate the memory used by a decoded object.
+std::size_t estimate_size(const git_object* object)
+{
+    constexpr std::size_t overhead = 128;
+    constexpr std::size_t tree_entry_size = 64;
+
+    switch (git_object_type(object))
+    {
+    case GIT_OBJECT_COMMIT:
+    {
+        const auto* commit = reinterpret_cast<const git_commit*>(object);
+        const char* raw_header = git_commit_raw_header(commit);
+        const char* message = git_commit_message_raw(commit);
+        return overhead + (raw_header ? std::strlen(raw_header) : 0)
+            + (message ? std::strlen(message) : 0);
+    }
+    case GIT_OBJECT_TREE:
+        return overhead
+            + git_tree_entrycount(reinterpret_cast<const git_tree*>(object)) * tree_entry_size;
+    default:
+        return overhead;
+    }
+}
+
+} // anonymous namespace
+
+ObjectCache::ObjectCache(std::size_t byte_budget)
+    : byte_budget_{ byte_budget }
+{ }
+
+LibGitObject ObjectCache::get(git_repository* repo, const Oid& id, git_object_t type)
+{
+    git_object* dup;
+
+    auto it = index_.find(id);
+    if (it != index_.end()
+        && (type == GIT_OBJECT_ANY || git_object_type(it->second->object.get()) == type))
+    {
+        ++hits_;
+        lru_.splice(lru_.begin(), lru_, it->second);
+        git_object_dup(&dup, it->second->object.get());
+        return { dup, git_object_free };
+    }
+
+    ++misses_;
+
+    git_object* object;
+    int error = git_object_lookup(&object, repo, &id.get(), type);
+    if (error)
+    {
+        throw Error{ error, cat("Cannot find object ", id.to_string(), ": ",
+            git_error_last()->message) };
+    }
+    LibGitObject result{ object, git_object_free };
+
+    const std::size_t bytes = estimate_size(object);
+    if (bytes <= byte_budget_ && it == index_.end())
+    {
+        git_object_dup(&dup, object);
+        lru_.push_front(Entry{ id, LibGitObject{ dup, git_object_free }, bytes });
+        index_.emplace(id, lru_.begin());
+        bytes_ += bytes;
+        evict();
+    }
+
+    return result;
+}
+
+void ObjectCache::clear() noexcept
+{
+    index_.clear();
+    lru_.clear();
+    bytes_ = 0;
+}
+
+void ObjectCache::set_byte_budget(std::size_t byte_budget)
+{
+    byte_budget_ = byte_budget;
+    evict();
+}
+
+ObjectCacheStats ObjectCache::stats() const noexcept
+{
+    ObjectCacheStats stats;
+    stats.hits = hits_;
+    stats.misses = misses_;
+    stats.evictions = evictions_;
+    stats.entries = lru_.size();
+    stats.bytes = bytes_;
+    return stats;
+}
+
+void ObjectCache::reset_stats() noexcept
+{
+    hits_ = 0;
+    misses_ = 0;
+    evictions_ = 0;
+}
+
+void ObjectCache::evict()
+{
+    while (bytes_ > byte_budget_ && not lru_.empty())
+    {
+        const Entry& entry = lru_.back();
+        bytes_ -= entry.bytes;
+        index_.erase(entry.id);
+        lru_.pop_back();
+        ++evictions_;
+    }
+}
+
+} // namespace git
@@ -0,0 +1,74 @@
+/**
+ * \file   Oid.cc
+ * \date   Created on October 16, 2026
+ * \brief  Implementation of the Oid class.
+ *
+ * \copyright Copyright 2026 Deutsches Elektronen-Synchrotron (DESY), Hamburg
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation, either version 2.1 of the license, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <algorithm>
+
+#include <git2.h>
+#include <gul14/cat.h>
+
+#include "libgit4cpp/Error.h"
+#include "libgit4cpp/Oid.h"
+
+using gul14::cat;
+
+namespace git {
+
+Oid Oid::from_string(std::string_view hex)
+{
+    if (hex.size() != 2 * size())
+        throw Error{ cat("Invalid object ID length: \"", hex, "\"") };
+
+    git_oid id;
+    int error = git_oid_fromstrn(&id, hex.data(), hex.size());
+    if (error)
+        throw Error{ error, cat("Invalid object ID: \"", hex, "\"") };
+
+    return Oid{ id };
+}
+
+bool Oid::is_zero() const noexcept
+{
+    return std::all_of(id_.id, id_.id + size(), [](unsigned char c) { return c == 0; });
+}
+
+std::string Oid::to_string() const
+{
+    char buf[2 * size() + 1];
+    git_oid_tostr(buf, sizeof(buf), &id_);
+    return buf;
+}
+
+std::string Oid::to_short_string(std::size_t length) const
+{
+    auto str = to_string();
+    if (length < str.size())
+        str.resize(length);
+    return str;
+}
+
+std::ostream& operator<<(std::ostream& stream, const Oid& oid)
+{
+    return stream << oid.to_string();
+}
+
+} // namespace git
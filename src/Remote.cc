@@ -34,11 +34,64 @@ using gul14::cat;
 
 namespace git {
 
+struct RemoteConnectionState
+{
+    /// The remote (null once the Remote has been destroyed).
+    git_remote* remote = nullptr;
+    /// Incremented whenever a connection is opened or closed.
+    std::uint64_t generation = 0;
+    /// True while a connection opened by Remote::connect() is open.
+    bool open = false;
+    /// Direction of the open connection.
+    Direction direction = Direction::fetch;
+    /// True if the open connection has carried a fetch or push already.
+    bool used = false;
+
+    /// Mark the connection as closed; outstanding RemoteConnection objects become stale.
+    void invalidate() noexcept
+    {
+        ++generation;
+        open = false;
+        used = false;
+    }
+};
+
 Remote::Remote(LibGitRemote&& remote_ptr)
     : remote_{ std::move(remote_ptr) }
+    , connection_{ std::make_shared<RemoteConnectionState>() }
 {
     if (remote_ == nullptr)
         throw Error{ "Remote pointer may not be null" };
+    connection_->remote = remote_.get();
+}
+
+Remote::Remote(Remote&& other) noexcept
+    : remote_{ std::move(other.remote_) }
+    , connection_{ std::move(other.connection_) }
+{ }
+
+Remote& Remote::operator=(Remote&& other) noexcept
+{
+    if (this != &other)
+    {
+        if (connection_)
+        {
+            connection_->invalidate();
+            connection_->remote = nullptr;
+        }
+        remote_ = std::move(other.remote_);
+        connection_ = std::move(other.connection_);
+    }
+    return *this;
+}
+
+Remote::~Remote()
+{
+    if (connection_)
+    {
+        connection_->invalidate();
+        connection_->remote = nullptr;
+    }
 }
 
 std::string Remote::get_name() const
@@ -53,37 +106,128 @@ std::string Remote::get_url() const
     return url ? url : "";
 }
 
-std::vector<std::string> Remote::list_references()
+RemoteConnection::RemoteConnection(std::shared_ptr<RemoteConnectionState> state,
+    std::uint64_t generation) noexcept
+    : state_{ std::move(state) }
+    , generation_{ generation }
+{ }
+
+RemoteConnection::RemoteConnection(RemoteConnection&& other) noexcept
+    : state_{ std::move(other.state_) }
+    , generation_{ other.generation_ }
+{ }
+
+RemoteConnection& RemoteConnection::operator=(RemoteConnection&& other) noexcept
+{
+    if (this != &other)
+    {
+        close();
+        state_ = std::move(other.state_);
+        generation_ = other.generation_;
+    }
+    return *this;
+}
+
+void RemoteConnection::close() noexcept
 {
-    if (!git_remote_connected(remote_.get()))
+    if (state_ && state_->remote && state_->generation == generation_)
     {
-        git_remote_callbacks callbacks = GIT_REMOTE_CALLBACKS_INIT;
-        callbacks.credentials = get_dummy_credentials_callback();
+        git_remote_disconnect(state_->remote);
+        state_->invalidate();
+    }
+    state_.reset();
+}
 
-        int error = git_remote_connect(remote_.get(), GIT_DIRECTION_FETCH, &callbacks,
-            nullptr, nullptr);
-        if (error < 0)
-        {
-            throw Error{ cat("Cannot connect to remote \"", get_name(), "\": ",
-                git_error_last()->message) };
-        }
+bool RemoteConnection::is_open() const noexcept
+{
+    return state_ && state_->remote && state_->generation == generation_
+        && git_remote_connected(state_->remote);
+}
+
+RemoteConnection Remote::connect(Direction direction)
+{
+    disconnect();
+
+    git_remote_callbacks callbacks = GIT_REMOTE_CALLBACKS_INIT;
+    callbacks.credentials = get_dummy_credentials_callback();
+
+    int error = git_remote_connect(remote_.get(),
+        direction == Direction::push ? GIT_DIRECTION_PUSH : GIT_DIRECTION_FETCH,
+        &callbacks, nullptr, nullptr);
+    if (error < 0)
+    {
+        throw Error{ error, cat("Cannot connect to remote \"", get_name(), "\": ",
+            git_error_last()->message) };
     }
 
+    connection_->invalidate();
+    connection_->open = true;
+    connection_->direction = direction;
+
+    return RemoteConnection{ connection_, connection_->generation };
+}
+
+void Remote::disconnect() noexcept
+{
+    if (is_connected())
+        git_remote_disconnect(remote_.get());
+    if (connection_)
+        connection_->invalidate();
+}
+
+bool Remote::is_connected() const noexcept
+{
+    return remote_ && git_remote_connected(remote_.get()) != 0;
+}
+
+bool Remote::claim_connection(Direction direction) const noexcept
+{
+    if (not is_connected())
+        return false;
+
+    auto& state = *connection_;
+    if (state.open && state.direction == direction && not state.used)
+    {
+        state.used = true;
+        return true;
+    }
+
+    // Wrong direction, already used up, or not opened by connect(): start afresh
+    git_remote_disconnect(remote_.get());
+    state.invalidate();
+    return false;
+}
+
+std::vector<RemoteHead> Remote::list_references()
+{
+    gul14::optional<RemoteConnection> temporary_connection;
+    if (not is_connected())
+        temporary_connection.emplace(connect());
+
     const git_remote_head** out{ nullptr };
     size_t size{ 0 };
     auto error = git_remote_ls(&out, &size, remote_.get());
     if (error)
     {
-        throw Error{ cat("Cannot list references on remote \"", get_name(), "\": ",
-            git_error_last()->message) };
+        throw Error{ error, cat("Cannot list references on remote \"", get_name(),
+            "\": ", git_error_last()->message) };
     }
 
-    std::vector<std::string> refs;
-    refs.reserve(size);
+    std::vector<RemoteHead> heads;
+    heads.reserve(size);
     for (size_t i = 0; i != size; ++i)
-        refs.emplace_back(out[i]->name);
+    {
+        RemoteHead head;
+        head.name = out[i]->name;
+        head.oid = out[i]->oid;
+        head.local_oid = out[i]->loid;
+        head.is_local = out[i]->local != 0;
+        if (out[i]->symref_target)
+            head.symref_target = out[i]->symref_target;
+        heads.push_back(std::move(head));
+    }
 
-    return refs;
+    return heads;
 }
 
 } // namespace git
@@ -22,45 +22,425 @@
 
 // SPDX-License-Identifier: LGPL-2.1-or-later
 
+#include <algorithm>
+#include <exception>
+#include <functional>
 #include <iostream>
+#include <map>
+#include <numeric>
+#include <set>
+#include <system_error>
 #include <vector>
 
 #include <git2.h>
 #include <gul14/cat.h>
 #include <gul14/finalizer.h>
 
+#if LIBGIT2_FULLVERSION >= 1002000
+#include <git2/sys/commit_graph.h>
+#include <git2/sys/midx.h>
+#endif
+
 #include "libgit4cpp/Error.h"
 #include "libgit4cpp/Repository.h"
 #include "libgit4cpp/wrapper_functions.h"
 #include "credentials_callback.h"
+#include "status_entry.h"
 
 using gul14::cat;
 
 namespace git {
 
-Repository::Repository(const std::filesystem::path& file_path)
+namespace {
+
+/// Maximum number of paths for which log() results are cached.
+constexpr std::size_t max_log_cache_size = 1024;
+
+/// Maximum number of commit pairs for which ahead_behind() results are cached.
+constexpr std::size_t max_ahead_behind_cache_size = 4096;
+
+/**
+ * Return the ID of the tree entry at the given path in the tree of a commit, or a zero
+ * ID if the path does not exist.
+ */
+Oid tree_entry_id(const git_commit* commit, const std::string& path)
+{
+    git_tree* tree;
+    int error = git_commit_tree(&tree, commit);
+    if (error)
+        throw Error{ error, cat("Cannot read tree of commit: ", git_error_last()->message) };
+    LibGitTree tree_owner{ tree, git_tree_free };
+
+    Oid id;
+    git_tree_entry* entry;
+    if (git_tree_entry_bypath(&entry, tree, path.c_str()) == 0)
+    {
+        id = *git_tree_entry_id(entry);
+        git_tree_entry_free(entry);
+    }
+    return id;
+}
+
+/**
+ * Look up the subtrees of a tree by their directory path. Each subtree is only looked up
+ * once, no matter how many paths below it are requested.
+ */
+class SubtreeCache
+{
+public:
+    SubtreeCache(git_repository* repo, const git_tree* root)
+        : repo_{ repo }, root_{ root }
+    { }
+
+    /**
+     * Return the tree for a directory path ("" for the root tree).
+     * \exception Error is thrown if the directory does not exist.
+     */
+    const git_tree* get(const std::string& dir)
+    {
+        if (dir.empty())
+            return root_;
+
+        auto it = trees_.find(dir);
+        if (it != trees_.end())
+            return it->second.get();
+
+        const auto slash = dir.rfind('/');
+        const std::string parent = slash == std::string::npos ? "" : dir.substr(0, slash);
+        const std::string name = slash == std::string::npos ? dir : dir.substr(slash + 1);
+
+        const git_tree_entry* entry = git_tree_entry_byname(get(parent), name.c_str());
+        if (entry == nullptr || git_tree_entry_type(entry) != GIT_OBJECT_TREE)
+            throw Error{ GIT_ENOTFOUND, cat("Cannot find directory \"", dir, "\"") };
+
+        git_tree* tree;
+        int error = git_tree_lookup(&tree, repo_, git_tree_entry_id(entry));
+        if (error)
+            throw Error{ error, cat("Cannot read directory \"", dir, "\": ", git_error_last()->message) };
+
+        return trees_.emplace(dir, LibGitTree{ tree, git_tree_free }).first->second.get();
+    }
+
+private:
+    git_repository* repo_;
+    const git_tree* root_;
+    std::map<std::string, LibGitTree> trees_;
+};
+
+/// A loose object file found in the object database.
+struct LooseObject
+{
+    git_oid id;
+    std::filesystem::path file;
+};
+
+/**
+ * Return all loose objects in an objects directory (objects/xx/yyyy...).
+ * \param bytes  Is increased by the size of each object file.
+ */
+std::vector<LooseObject> find_loose_objects(const std::filesystem::path& objects_dir,
+    std::size_t& bytes)
+{
+    namespace fs = std::filesystem;
+
+    std::vector<LooseObject> objects;
+    std::error_code ec;
+
+    for (const auto& dir : fs::directory_iterator{ objects_dir, ec })
+    {
+        const auto dir_name = dir.path().filename().string();
+        if (dir_name.size() != 2 || not dir.is_directory(ec))
+            continue;
+
+        for (const auto& file : fs::directory_iterator{ dir.path(), ec })
+        {
+            const auto hex = dir_name + file.path().filename().string();
+            if (hex.size() != GIT_OID_HEXSZ || not file.is_regular_file(ec))
+                continue;
+
+            LooseObject object;
+            if (git_oid_fromstr(&object.id, hex.c_str()))
+                continue; // not an object (e.g. a temporary file)
+
+            object.file = file.path();
+            bytes += static_cast<std::size_t>(file.file_size(ec));
+            objects.push_back(std::move(object));
+        }
+    }
+
+    return objects;
+}
+
+/// Return the names of the pack files in a pack directory.
+std::set<std::filesystem::path> list_pack_files(const std::filesystem::path& pack_dir)
+{
+    std::set<std::filesystem::path> packs;
+    std::error_code ec;
+    for (const auto& file : std::filesystem::directory_iterator{ pack_dir, ec })
+    {
+        if (file.path().extension() == ".pack")
+            packs.insert(file.path());
+    }
+    return packs;
+}
+
+#if LIBGIT2_FULLVERSION >= 1000000
+using TransferProgress = git_indexer_progress;
+#else
+using TransferProgress = git_transfer_progress;
+#endif
+
+/// State shared between Repository::fetch() and the libgit2 progress callback.
+struct FetchPayload
+{
+    const std::function<bool(const FetchStats&)>& progress;
+    std::chrono::steady_clock::time_point start_time;
+    std::exception_ptr exception;
+};
+
+/// Convert libgit2's transfer progress into a FetchStats object.
+FetchStats to_fetch_stats(const TransferProgress& p,
+    std::chrono::steady_clock::time_point start_time)
+{
+    FetchStats stats;
+    stats.total_objects = p.total_objects;
+    stats.received_objects = p.received_objects;
+    stats.indexed_objects = p.indexed_objects;
+    stats.local_objects = p.local_objects;
+    stats.total_deltas = p.total_deltas;
+    stats.indexed_deltas = p.indexed_deltas;
+    stats.received_bytes = p.received_bytes;
+    stats.duration = std::chrono::steady_clock::now() - start_time;
+    return stats;
+}
+
+int fetch_progress_callback(const TransferProgress* p, void* payload_ptr)
+{
+    auto& payload = *static_cast<FetchPayload*>(payload_ptr);
+
+    try
+    {
+        if (payload.progress(to_fetch_stats(*p, payload.start_time)))
+            return 0;
+    }
+    catch (...)
+    {
+        payload.exception = std::current_exception();
+    }
+
+    git_error_set_str(GIT_ERROR_CALLBACK, "Fetch cancelled by progress callback");
+    return GIT_EUSER;
+}
+
+/// State shared between Repository::push() and the libgit2 progress callback.
+struct PushPayload
+{
+    const std::function<bool(const PushStats&)>& progress;
+    std::chrono::steady_clock::time_point start_time;
+    PushStats stats;
+    std::exception_ptr exception;
+};
+
+int push_progress_callback(unsigned int current, unsigned int total, std::size_t bytes,
+    void* payload_ptr)
+{
+    auto& payload = *static_cast<PushPayload*>(payload_ptr);
+
+    payload.stats.sent_objects = current;
+    payload.stats.total_objects = total;
+    payload.stats.sent_bytes = bytes;
+    payload.stats.duration = std::chrono::steady_clock::now() - payload.start_time;
+
+    if (not payload.progress)
+        return 0;
+
+    try
+    {
+        if (payload.progress(payload.stats))
+            return 0;
+    }
+    catch (...)
+    {
+        payload.exception = std::current_exception();
+    }
+
+    git_error_set_str(GIT_ERROR_CALLBACK, "Push cancelled by progress callback");
+    return GIT_EUSER;
+}
+
+git_remote_autotag_option_t to_autotag_option(TagPolicy policy)
+{
+    switch (policy)
+    {
+    case TagPolicy::unspecified: return GIT_REMOTE_DOWNLOAD_TAGS_UNSPECIFIED;
+    case TagPolicy::auto_follow: return GIT_REMOTE_DOWNLOAD_TAGS_AUTO;
+    case TagPolicy::none: return GIT_REMOTE_DOWNLOAD_TAGS_NONE;
+    case TagPolicy::all: return GIT_REMOTE_DOWNLOAD_TAGS_ALL;
+    }
+    throw Error{ "Invalid tag policy" };
+}
+
+git_clone_local_t to_clone_local(LocalClone local)
+{
+    switch (local)
+    {
+    case LocalClone::automatic: return GIT_CLONE_LOCAL_AUTO;
+    case LocalClone::always: return GIT_CLONE_LOCAL;
+    case LocalClone::never: return GIT_CLONE_NO_LOCAL;
+    case LocalClone::no_hardlinks: return GIT_CLONE_LOCAL_NO_LINKS;
+    }
+    throw Error{ "Invalid local clone mode" };
+}
+
+/// Create the "origin" remote of a clone so that it only fetches a single branch.
+int create_single_branch_remote(git_remote** out, git_repository* repo,
+    const char* name, const char* url, void* payload)
+{
+    const auto& branch = *static_cast<const std::string*>(payload);
+    const auto fetchspec = cat("+refs/heads/", branch, ":refs/remotes/", name, "/",
+        branch);
+    return git_remote_create_with_fetchspec(out, repo, name, url, fetchspec.c_str());
+}
+
+} // anonymous namespace
+
+Repository::Repository(const std::filesystem::path& file_path, OpenMode mode)
     : repo_path_{ file_path }
+    , open_mode_{ mode }
 {
-    git_libgit2_init();
     init(file_path);
 }
 
+Repository::Repository(const std::filesystem::path& file_path, const InitOptions& options)
+    : repo_path_{ file_path }
+    , open_mode_{ OpenMode::open_only }
+{
+    if (repository_open(repo_path_))
+        throw Error{ GIT_EEXISTS, cat("Repository already exists at ", file_path) };
+
+    repo_ = repository_init(file_path, options.bare, options.initial_head);
+    if (not repo_)
+        throw Error{ cat("Git init failed: ", git_error_last()->message) };
+
+    if (options.initial_commit && not options.bare)
+    {
+        // Nothing is tracked yet, so update() would stage nothing
+        add();
+        commit_initial();
+    }
+}
+
+Repository Repository::open(const std::filesystem::path& file_path)
+{
+    return Repository{ file_path, OpenMode::open_only };
+}
+
+Repository Repository::create(const std::filesystem::path& file_path,
+    const InitOptions& options)
+{
+    return Repository{ file_path, options };
+}
+
+Repository::Repository(const std::string& url, const std::filesystem::path& file_path,
+    const CloneOptions& options)
+    : repo_path_{ file_path }
+    , open_mode_{ OpenMode::open_only }
+{
+    if (options.single_branch && options.branch.empty())
+        throw Error{ GIT_EINVALIDSPEC, "A single-branch clone needs a branch name" };
+
+    git_clone_options clone_options;
+    int error = git_clone_init_options(&clone_options, GIT_CLONE_OPTIONS_VERSION);
+    if (error)
+        throw Error{ cat("Init clone: ", git_error_last()->message) };
+
+    FetchPayload payload{ options.progress, std::chrono::steady_clock::now(), nullptr };
+
+    clone_options.bare = options.bare ? 1 : 0;
+    clone_options.local = to_clone_local(options.local);
+    if (options.no_checkout)
+        clone_options.checkout_opts.checkout_strategy = GIT_CHECKOUT_NONE;
+    if (not options.branch.empty())
+        clone_options.checkout_branch = options.branch.c_str();
+    if (options.single_branch)
+    {
+        clone_options.remote_cb = create_single_branch_remote;
+        clone_options.remote_cb_payload = const_cast<std::string*>(&options.branch);
+    }
+
+    auto& fetch_options = clone_options.fetch_opts;
+    fetch_options.callbacks.credentials = get_dummy_credentials_callback();
+    if (options.progress)
+    {
+        fetch_options.callbacks.transfer_progress = fetch_progress_callback;
+        fetch_options.callbacks.payload = &payload;
+    }
+
+    if (options.depth > 0)
+    {
+#if LIBGIT2_FULLVERSION >= 1007000
+        fetch_options.depth = static_cast<int>(options.depth);
+
+        // A direct copy of the object files would ignore the depth, so go through the
+        // transport, which reports whether it supports shallow fetches
+        if (options.local == LocalClone::always
+            || options.local == LocalClone::no_hardlinks)
+        {
+            throw Error{ "A shallow clone cannot copy objects from the local filesystem" };
+        }
+        clone_options.local = GIT_CLONE_NO_LOCAL;
+#else
+        throw Error{ "Shallow clones require libgit2 1.7 or newer" };
+#endif
+    }
+
+    repo_ = git::clone(url, file_path.string(), &clone_options);
+
+    if (payload.exception)
+        std::rethrow_exception(payload.exception);
+    if (not repo_)
+    {
+        throw Error{ cat("Cannot clone \"", url, "\" into ", file_path, ": ",
+            git_error_last()->message) };
+    }
+}
+
+Repository Repository::clone(const std::string& url,
+    const std::filesystem::path& file_path, const CloneOptions& options)
+{
+    return Repository{ url, file_path, options };
+}
+
 Repository::~Repository()
 {
+    // Do not lose deferred index modifications; errors cannot be reported here
+    if (index_ && index_dirty_)
+        git_index_write(index_.get());
+    index_.reset();
+
+    // Cached objects belong to repo_ and must be freed before it
+    object_cache_.clear();
+
     repo_.reset();
     my_signature_.reset();
-    git_libgit2_shutdown();
 }
 
-void Repository::make_signature()
+const git_signature* Repository::get_signature()
 {
-    my_signature_ = signature_default(repo_.get());
     if (not my_signature_)
-        my_signature_ = signature_new("Taskomat", "(none)", std::time(0), 0);
+    {
+        my_signature_ = signature_default(repo_.get());
+        if (not my_signature_)
+            my_signature_ = signature_new("Taskomat", "(none)", std::time(0), 0);
+    }
+    return my_signature_.get();
 }
 
 void Repository::reset_repo()
 {
+    invalidate_index();
+    log_cache_.clear();
+    object_cache_.clear();
     repo_.reset();
     my_signature_.reset();
 
@@ -84,55 +464,145 @@ git_repository* Repository::get_repo()
     return repo_.get();
 }
 
+bool Repository::is_bare() const
+{
+    return git_repository_is_bare(repo_.get()) != 0;
+}
+
+Oid Repository::head_oid()
+{
+    git_oid id;
+    int error = git_reference_name_to_id(&id, repo_.get(), "HEAD");
+    if (error == GIT_ENOTFOUND || error == GIT_EUNBORNBRANCH)
+        return Oid{ };
+    if (error)
+        throw Error{ error, cat("Cannot resolve HEAD: ", git_error_last()->message) };
+    return id;
+}
+
+Oid Repository::resolve(const std::string& refname)
+{
+    git_oid id;
+    int error = git_reference_name_to_id(&id, repo_.get(), refname.c_str());
+    if (error)
+    {
+        throw Error{ error, cat("Cannot resolve reference \"", refname, "\": ",
+            git_error_last()->message) };
+    }
+    return id;
+}
+
 void Repository::update(const std::string& glob)
 {
-    auto index = repository_index(repo_.get());
+    auto index = get_index();
 
     char *paths[1] = {const_cast<char*>(glob.c_str())};
     git_strarray array = { paths, 1 };
 
     // update index to check for files
-    git_index_update_all(index.get(), &array, nullptr, nullptr);
-    git_index_write(index.get());
+    git_index_update_all(index, &array, nullptr, nullptr);
+    index_modified();
+}
+
+git_index* Repository::get_index()
+{
+    if (not index_)
+    {
+        index_ = repository_index(repo_.get());
+        if (not index_)
+            throw Error{ cat("Cannot load index: ", git_error_last()->message) };
+    }
+    return index_.get();
+}
+
+void Repository::index_modified()
+{
+    if (defer_index_write_)
+        index_dirty_ = true;
+    else
+        write_index_to_disk();
+}
+
+void Repository::write_index_to_disk()
+{
+    int error = git_index_write(get_index());
+    if (error)
+        throw Error{ error, cat("Cannot write index: ", git_error_last()->message) };
+    index_dirty_ = false;
+}
+
+void Repository::invalidate_index() noexcept
+{
+    // The index object is shared with libgit2's repository object, so unwritten
+    // modifications must be discarded explicitly by reloading it from disk.
+    if (index_ && index_dirty_)
+        git_index_read(index_.get(), 1);
+
+    index_.reset();
+    index_dirty_ = false;
+}
+
+void Repository::set_deferred_index_write(bool defer)
+{
+    defer_index_write_ = defer;
+    if (not defer && index_dirty_)
+        write_index_to_disk();
+}
+
+void Repository::write_index()
+{
+    if (index_dirty_)
+        write_index_to_disk();
 }
 
 void Repository::init(const std::filesystem::path& file_path)
 {
     repo_ = repository_open(repo_path_);
 
-    if (not repo_)
+    if (repo_)
+        return;
+
+    switch (open_mode_)
     {
+    case OpenMode::open_only:
+        throw Error{ GIT_ENOTFOUND, cat("Cannot open repository at ", file_path) };
+
+    case OpenMode::init_bare:
+        // 2nd argument: true so that the repository itself is created in given path
+        repo_ = repository_init(file_path, true);
+        if (not repo_)
+            throw Error{ "Git init failed" };
+        break;
+
+    case OpenMode::init_with_workdir:
         // create repository
         // 2nd argument: false so that .git folder is created in given path
         repo_ = repository_init(file_path, false);
         if (not repo_)
             throw Error{ "Git init failed" };
 
-        make_signature();
         update();
         commit_initial();
-    }
-    else
-    {
-        make_signature();
+        break;
     }
 }
 
 void Repository::commit_initial()
 {
     // prepare gitlib data types
-    auto index = repository_index(repo_.get());
+    auto index = get_index();
     git_oid tree_id, commit_id;
 
-    git_index_write_tree(&tree_id, index.get());
-    auto tree = tree_lookup(repo_.get(), tree_id);
+    write_index();
+    git_index_write_tree(&tree_id, index);
+    auto tree = lookup_tree(tree_id);
 
     int error = git_commit_create(
         &commit_id,
         repo_.get(),
         "HEAD",
-        my_signature_.get(),
-        my_signature_.get(),
+        get_signature(),
+        get_signature(),
         "UTF-8",
         "Initial commit",
         tree.get(),
@@ -150,18 +620,19 @@ void Repository::commit(const std::string& commit_message)
     const git_commit* raw_commit = parent_commit.get();
 
     //define types for commit call and get index
-    auto index = repository_index(repo_.get());
+    auto index = get_index();
     git_oid tree_id, commit_id;
 
-    git_index_write_tree(&tree_id, index.get());
-    auto tree = tree_lookup(repo_.get(), tree_id);
+    write_index();
+    git_index_write_tree(&tree_id, index);
+    auto tree = lookup_tree(tree_id);
 
     int error = git_commit_create(
         &commit_id,
         repo_.get(),
         "HEAD",
-        my_signature_.get(),
-        my_signature_.get(),
+        get_signature(),
+        get_signature(),
         "UTF-8",
         commit_message.c_str(),
         tree.get(),
@@ -173,46 +644,87 @@ void Repository::commit(const std::string& commit_message)
         throw Error{ cat("Commit: ", git_error_last()->message) };
 }
 
+git_oid Repository::create_commit(const git_oid& tree_id, const std::string& commit_message,
+    const std::string& ref)
+{
+    auto tree = lookup_tree(tree_id);
+
+    // The current target of the reference (if any) becomes the parent
+    LibGitCommit parent_commit{ nullptr, git_commit_free };
+    git_oid parent_id;
+    int error = git_reference_name_to_id(&parent_id, repo_.get(), ref.c_str());
+    if (error == 0)
+    {
+        parent_commit = lookup_commit(parent_id);
+    }
+    else if (error != GIT_ENOTFOUND && error != GIT_EUNBORNBRANCH)
+    {
+        throw Error{ error, cat("Cannot resolve reference \"", ref, "\": ",
+            git_error_last()->message) };
+    }
+
+    const git_commit* raw_commit = parent_commit.get();
+    git_oid commit_id;
+
+    error = git_commit_create(
+        &commit_id,
+        repo_.get(),
+        ref.c_str(),
+        get_signature(),
+        get_signature(),
+        "UTF-8",
+        commit_message.c_str(),
+        tree.get(),
+        raw_commit ? 1 : 0,
+        &raw_commit
+    );
+
+    if (error)
+        throw Error{ error, cat("Commit: ", git_error_last()->message) };
+
+    return commit_id;
+}
+
 void Repository::add(const std::string& glob)
 {
-    auto gindex = repository_index(repo_.get());
+    auto gindex = get_index();
 
     char *paths[] = { const_cast<char*>(glob.c_str()) };
     git_strarray array = { paths, 1 };
 
-    int error = git_index_add_all(gindex.get(), &array, GIT_INDEX_ADD_DEFAULT, nullptr,
+    int error = git_index_add_all(gindex, &array, GIT_INDEX_ADD_DEFAULT, nullptr,
         nullptr);
     if (error)
         throw Error{ cat("Cannot stage files: ", git_error_last()->message) };
 
-    git_index_write(gindex.get());
+    index_modified();
 }
 
 void Repository::remove_directory(const std::filesystem::path& directory)
 {
-    auto gindex = repository_index(repo_.get());
+    auto gindex = get_index();
 
-    int error = git_index_remove_directory(gindex.get(), directory.c_str(), 0);
+    int error = git_index_remove_directory(gindex, directory.c_str(), 0);
     if (error)
         throw Error{ cat("Cannot remove directory: ", git_error_last()->message) };
 
-    git_index_write(gindex.get());
+    index_modified();
 }
 
 void Repository::remove_files(const std::vector<std::filesystem::path>& filepaths)
 {
-    auto gindex = repository_index(repo_.get());
+    auto gindex = get_index();
 
     //remove files from directory
     //TODO: Teste, ob oberer Teil ausreicht
     for (auto gfile: filepaths)
     {
-        int error = git_index_remove_bypath(gindex.get(), gfile.c_str());
+        int error = git_index_remove_bypath(gindex, gfile.c_str());
         if (error)
             throw Error{ cat("Cannot remove file: ", git_error_last()->message) };
     }
 
-    git_index_write(gindex.get());
+    index_modified();
 }
 
 LibGitCommit Repository::get_commit(unsigned int count)
@@ -224,9 +736,47 @@ LibGitCommit Repository::get_commit(unsigned int count)
     return { parent, git_commit_free };
 }
 
+git_oid Repository::resolve_commit(const std::string& revision)
+{
+    auto object = revparse_single(repo_.get(), revision);
+    if (not object)
+    {
+        throw Error{ cat("Cannot find revision \"", revision, "\": ",
+            git_error_last()->message) };
+    }
+
+    git_object* commit;
+    int error = git_object_peel(&commit, object.get(), GIT_OBJECT_COMMIT);
+    if (error)
+        throw Error{ error, cat("Revision \"", revision, "\" is not a commit") };
+
+    const git_oid id = *git_object_id(commit);
+    git_object_free(commit);
+    return id;
+}
+
+LibGitTree Repository::resolve_tree(const std::string& revision)
+{
+    if (revision.empty())
+        return { nullptr, git_tree_free };
+
+    auto object = revparse_single(repo_.get(), revision);
+    if (not object)
+    {
+        throw Error{ cat("Cannot find revision \"", revision, "\": ",
+            git_error_last()->message) };
+    }
+
+    git_object* tree;
+    int error = git_object_peel(&tree, object.get(), GIT_OBJECT_TREE);
+    if (error)
+        throw Error{ error, cat("Revision \"", revision, "\" has no tree") };
+
+    return { reinterpret_cast<git_tree*>(tree), git_tree_free };
+}
+
 LibGitCommit Repository::get_commit(const std::string& ref)
 {
-    git_commit* commit;
     git_oid oid_parent_commit;
 
     // resolve HEAD into a SHA1
@@ -235,196 +785,616 @@ LibGitCommit Repository::get_commit(const std::string& ref)
         throw Error{ cat("Cannot find ID from reference name: ", git_error_last()->message) };
 
     // find commit object by commit ID
-    error = git_commit_lookup(&commit, repo_.get(), &oid_parent_commit);
-    if (error)
-        throw Error{ "Cannot find HEAD of branch" };
+    return lookup_commit(oid_parent_commit);
+}
+
+LibGitCommit Repository::lookup_commit(const git_oid& id)
+{
+    auto object = object_cache_.get(repo_.get(), id, GIT_OBJECT_COMMIT);
+    return { reinterpret_cast<git_commit*>(object.release()), git_commit_free };
+}
 
-    return { commit, git_commit_free };
+LibGitTree Repository::lookup_tree(const git_oid& id)
+{
+    auto object = object_cache_.get(repo_.get(), id, GIT_OBJECT_TREE);
+    return { reinterpret_cast<git_tree*>(object.release()), git_tree_free };
 }
 
-bool Repository::is_unstaged(FileStatus& filestats, const git_status_entry* s)
+RepoState Repository::collect_status(LibGitStatusList& status) const
 {
-    std::string wstatus = "";
+    const size_t nr_entries = git_status_list_entrycount(status.get());
 
-    if (s->status & GIT_STATUS_WT_MODIFIED)
-        wstatus = "modified";
-    if (s->status & GIT_STATUS_WT_DELETED)
-        wstatus = "deleted";
-    if (s->status & GIT_STATUS_WT_RENAMED)
-        wstatus = "renamed";
-    if (s->status & GIT_STATUS_WT_TYPECHANGE)
-        wstatus = "typechange";
+    RepoState return_array{ };
+    return_array.reserve(nr_entries);
 
-    if (wstatus.empty())
-        return false;
+    DecodedStatusEntry entry;
+    for (size_t i = 0; i < nr_entries; ++i)
+    {
+        if (not decode_status_entry(git_status_byindex(status.get(), i), entry))
+            continue;
 
-    filestats.handling = "unstaged";
-    filestats.changes = wstatus;
+        return_array.push_back(FileStatus{ format_path_name(entry),
+            std::string{ to_string(entry.handling) },
+            std::string{ to_string(entry.changes) } });
+    }
+    return return_array;
+}
 
-    const char* old_path = s->index_to_workdir->old_file.path;
-    const char* new_path = s->index_to_workdir->new_file.path;
+CompactRepoState Repository::collect_compact_status(LibGitStatusList& status) const
+{
+    const size_t nr_entries = git_status_list_entrycount(status.get());
 
-    if (old_path && new_path && strcmp(old_path, new_path))
-        filestats.path_name = cat(old_path, " -> ", new_path);
-    else
-        filestats.path_name = old_path ? old_path : new_path;
+    CompactRepoState return_array{ };
+    return_array.reserve(nr_entries);
+
+    DecodedStatusEntry entry;
+    for (size_t i = 0; i < nr_entries; ++i)
+    {
+        if (not decode_status_entry(git_status_byindex(status.get(), i), entry))
+            continue;
+
+        return_array.push_back(
+            CompactFileStatus{ format_path_name(entry), entry.handling, entry.changes });
+    }
+    return return_array;
+}
+
+RepoState Repository::status()
+{
+    return status(StatusOptions{ });
+}
+
+RepoState Repository::status(const StatusOptions& options)
+{
+    auto my_status = make_status_list(options);
+    return collect_status(my_status);
+}
 
-    return true;
+CompactRepoState Repository::compact_status(const StatusOptions& options)
+{
+    auto my_status = make_status_list(options);
+    return collect_compact_status(my_status);
 }
 
-bool Repository::is_staged(FileStatus& filestats, const git_status_entry* s)
+StatusList Repository::status_view(const StatusOptions& options)
 {
-    std::string istatus = "";
+    return StatusList{ make_status_list(options) };
+}
 
-    if (s->status & GIT_STATUS_INDEX_NEW)
-        istatus = "new file";
-    if (s->status & GIT_STATUS_INDEX_MODIFIED)
-        istatus = "modified";
-    if (s->status & GIT_STATUS_INDEX_DELETED)
-        istatus = "deleted";
-    if (s->status & GIT_STATUS_INDEX_RENAMED)
-        istatus = "renamed";
-    if (s->status & GIT_STATUS_INDEX_TYPECHANGE)
-        istatus = "typechange";
+CommitRange Repository::commits(const CommitRangeOptions& options)
+{
+    return CommitRange{ repo_.get(), options };
+}
 
-    if (istatus.empty())
-        return false;
+Diff Repository::diff(const std::string& rev_a, const std::string& rev_b,
+    const DiffOptions& options)
+{
+    auto tree_a = resolve_tree(rev_a);
+    auto tree_b = resolve_tree(rev_b);
+    return Diff::tree_to_tree(repo_.get(), tree_a.get(), tree_b.get(), options);
+}
 
-    filestats.handling = "staged";
-    filestats.changes = std::string{istatus};
+Diff Repository::diff_index_to_workdir(const DiffOptions& options)
+{
+    return Diff::index_to_workdir(repo_.get(), get_index(), options);
+}
 
-    const char* old_path = s->head_to_index->old_file.path;
-    const char* new_path = s->head_to_index->new_file.path;
+Diff Repository::diff_head_to_index(const DiffOptions& options)
+{
+    LibGitTree head_tree{ nullptr, git_tree_free };
 
-    if (old_path && new_path && strcmp(old_path, new_path))
-        filestats.path_name = cat(old_path, " -> ", new_path);
-    else
-        filestats.path_name = old_path ? old_path : new_path;
+    git_oid head_id;
+    int error = git_reference_name_to_id(&head_id, repo_.get(), "HEAD");
+    if (error == 0)
+        head_tree = resolve_tree("HEAD");
+    else if (error != GIT_ENOTFOUND && error != GIT_EUNBORNBRANCH)
+        throw Error{ error, cat("Cannot resolve HEAD: ", git_error_last()->message) };
 
-    return true;
+    return Diff::tree_to_index(repo_.get(), head_tree.get(), get_index(), options);
 }
 
-RepoState Repository::collect_status(LibGitStatusList& status) const
+BlobView Repository::read_blob(const std::string& revision,
+    const std::filesystem::path& path)
 {
-    // get number of submodules
-    const size_t nr_entries = git_status_list_entrycount(status.get());
+    if (revision.empty())
+        throw Error{ "read_blob: Revision must not be empty" };
 
-    // declare status holding vector for each submodule
-    RepoState return_array{ };
-    FileStatus filestats{ };
+    auto tree = resolve_tree(revision);
+    const std::string path_str = path.generic_string();
 
-    for (size_t i = 0; i < nr_entries; ++i)
+    git_tree_entry* raw_entry;
+    int error = git_tree_entry_bypath(&raw_entry, tree.get(), path_str.c_str());
+    if (error)
     {
-        const git_status_entry* s = git_status_byindex(status.get(), i);
-        const char* old_path = nullptr;
-        const char* new_path = nullptr;
+        throw Error{ error, cat("read_blob: Cannot find \"", path_str, "\" in \"",
+            revision, "\"") };
+    }
+    LibGitTreeEntry entry{ raw_entry, git_tree_entry_free };
 
-        std::string istatus = "";
-        std::string wstatus = "";
+    if (git_tree_entry_type(entry.get()) != GIT_OBJECT_BLOB)
+        throw Error{ cat("read_blob: \"", path_str, "\" is not a file") };
 
-        // list files which exists but are untouched since last commit
-        //############################################################
-        if (s->status == GIT_STATUS_CURRENT)
-        {
-            filestats.handling = "unchanged";
-            filestats.changes = "unchanged";
+    git_blob* blob;
+    error = git_blob_lookup(&blob, repo_.get(), git_tree_entry_id(entry.get()));
+    if (error)
+        throw Error{ error, cat("read_blob: Cannot read \"", path_str, "\": ", git_error_last()->message) };
 
-            old_path = s->head_to_index->old_file.path;
-            new_path = s->head_to_index->new_file.path;
+    return BlobView{ LibGitBlob{ blob, git_blob_free } };
+}
 
-            filestats.path_name = old_path ? old_path : new_path;
+std::vector<BlobView> Repository::read_blobs(const std::string& revision,
+    const std::vector<std::filesystem::path>& paths)
+{
+    if (revision.empty())
+        throw Error{ "read_blobs: Revision must not be empty" };
+
+    auto root = resolve_tree(revision);
+
+    std::vector<std::string> path_strs;
+    path_strs.reserve(paths.size());
+    for (const auto& path : paths)
+        path_strs.push_back(path.generic_string());
+
+    // Visit the paths in sorted order so that files in the same directory are read
+    // one after another
+    std::vector<std::size_t> order(paths.size());
+    std::iota(order.begin(), order.end(), std::size_t{ 0 });
+    std::sort(order.begin(), order.end(),
+        [&path_strs](std::size_t a, std::size_t b) { return path_strs[a] < path_strs[b]; });
+
+    SubtreeCache subtrees{ repo_.get(), root.get() };
+    std::vector<LibGitBlob> blobs;
+    blobs.reserve(paths.size());
+    for (std::size_t i = 0; i != paths.size(); ++i)
+        blobs.emplace_back(nullptr, git_blob_free);
+
+    for (const auto idx : order)
+    {
+        const auto& path = path_strs[idx];
+        const auto slash = path.rfind('/');
+        const std::string dir = slash == std::string::npos ? "" : path.substr(0, slash);
+        const char* name = path.c_str() + (slash == std::string::npos ? 0 : slash + 1);
 
-            return_array.push_back(filestats);
+        const git_tree_entry* entry = git_tree_entry_byname(subtrees.get(dir), name);
+        if (entry == nullptr)
+        {
+            throw Error{ GIT_ENOTFOUND, cat("read_blobs: Cannot find \"", path, "\" in \"",
+                revision, "\"") };
+        }
+        if (git_tree_entry_type(entry) != GIT_OBJECT_BLOB)
+            throw Error{ cat("read_blobs: \"", path, "\" is not a file") };
 
-            continue;
+        git_blob* blob;
+        int error = git_blob_lookup(&blob, repo_.get(), git_tree_entry_id(entry));
+        if (error)
+        {
+            throw Error{ error, cat("read_blobs: Cannot read \"", path, "\": ",
+                git_error_last()->message) };
         }
+        blobs[idx].reset(blob);
+    }
+
+    std::vector<BlobView> result;
+    result.reserve(blobs.size());
+    for (auto& blob : blobs)
+        result.emplace_back(std::move(blob));
+    return result;
+}
+
+void Repository::write_commit_graph()
+{
+#if LIBGIT2_FULLVERSION >= 1002000
+    auto walk = revwalk_new(repo_.get());
+    if (not walk)
+        throw Error{ cat("Cannot create revision walker: ", git_error_last()->message) };
+
+    int error = git_revwalk_push_glob(walk.get(), "refs/*");
+    if (error)
+        throw Error{ error, cat("Cannot walk references: ", git_error_last()->message) };
+
+    const auto info_dir = std::filesystem::path{ git_repository_commondir(repo_.get()) }
+        / "objects" / "info";
+
+    git_commit_graph_writer* raw_writer;
+#if LIBGIT2_FULLVERSION >= 1008000
+    error = git_commit_graph_writer_new(&raw_writer, info_dir.string().c_str(), nullptr);
+#else
+    error = git_commit_graph_writer_new(&raw_writer, info_dir.string().c_str());
+#endif
+    if (error)
+        throw Error{ error, cat("Cannot create commit-graph writer: ", git_error_last()->message) };
+    std::unique_ptr<git_commit_graph_writer, void(*)(git_commit_graph_writer*)>
+        writer{ raw_writer, git_commit_graph_writer_free };
+
+    error = git_commit_graph_writer_add_revwalk(writer.get(), walk.get());
+    if (error)
+        throw Error{ error, cat("Cannot collect commits: ", git_error_last()->message) };
+
+#if LIBGIT2_FULLVERSION >= 1008000
+    error = git_commit_graph_writer_commit(writer.get());
+#else
+    error = git_commit_graph_writer_commit(writer.get(), nullptr);
+#endif
+    if (error)
+        throw Error{ error, cat("Cannot write commit-graph: ", git_error_last()->message) };
+
+    // Tell libgit2 (and git) to use the file
+    git_config* config;
+    error = git_repository_config(&config, repo_.get());
+    if (error)
+        throw Error{ error, cat("Cannot open configuration: ", git_error_last()->message) };
+    error = git_config_set_bool(config, "core.commitGraph", 1);
+    git_config_free(config);
+    if (error)
+        throw Error{ error, cat("Cannot enable commit-graph: ", git_error_last()->message) };
+#else
+    throw Error{ GIT_ERROR, "write_commit_graph() requires libgit2 1.2 or newer" };
+#endif
+}
+
+MaintenanceStats Repository::maintenance(const MaintenanceOptions& options)
+{
+    namespace fs = std::filesystem;
+
+    const auto start_time = std::chrono::steady_clock::now();
+    MaintenanceStats stats;
+
+#if LIBGIT2_FULLVERSION < 1002000
+    if (options.write_multi_pack_index)
+        throw Error{ GIT_ERROR, "Writing a multi-pack-index requires libgit2 1.2 or newer" };
+    if (options.write_commit_graph)
+        throw Error{ GIT_ERROR, "Writing a commit-graph requires libgit2 1.2 or newer" };
+#endif
+
+    const fs::path objects_dir = fs::path{ git_repository_commondir(repo_.get()) } / "objects";
+    const fs::path pack_dir = objects_dir / "pack";
+
+    const auto loose_objects = find_loose_objects(objects_dir, stats.loose_bytes);
+
+    if (not loose_objects.empty())
+    {
+        git_packbuilder* raw_builder;
+        int error = git_packbuilder_new(&raw_builder, repo_.get());
+        if (error)
+            throw Error{ error, cat("Cannot create packbuilder: ", git_error_last()->message) };
+        std::unique_ptr<git_packbuilder, void(*)(git_packbuilder*)>
+            builder{ raw_builder, git_packbuilder_free };
 
-        // list files which were touched but stil are unchanged
-        //#####################################################
+        git_packbuilder_set_threads(builder.get(), options.threads);
 
-        if (is_unstaged(filestats, s))
+        for (const auto& object : loose_objects)
         {
-            return_array.push_back(filestats);
-            continue;
+            error = git_packbuilder_insert(builder.get(), &object.id, nullptr);
+            if (error)
+                throw Error{ error, cat("Cannot pack object: ", git_error_last()->message) };
         }
 
-        // list files which are staged for next commit
-        //############################################
+        const auto old_packs = list_pack_files(pack_dir);
+
+        error = git_packbuilder_write(builder.get(), pack_dir.string().c_str(), 0,
+            nullptr, nullptr);
+        if (error)
+            throw Error{ error, cat("Cannot write pack file: ", git_error_last()->message) };
 
+        stats.objects_packed = git_packbuilder_written(builder.get());
 
-        if (is_staged(filestats, s))
+        std::error_code ec;
+        for (const auto& pack : list_pack_files(pack_dir))
         {
-            return_array.push_back(filestats);
-            continue;
+            if (old_packs.count(pack) == 0)
+                stats.pack_bytes += static_cast<std::size_t>(fs::file_size(pack, ec));
         }
 
-        // list untracked files
-        //######################
-        if (s->status == GIT_STATUS_WT_NEW)
+        // Make the new pack visible before the loose objects disappear
+        git_odb* odb;
+        if (git_repository_odb(&odb, repo_.get()) == 0)
         {
+            git_odb_refresh(odb);
+            git_odb_free(odb);
+        }
 
-            filestats.handling = "untracked";
-            filestats.changes = "untracked";
-            filestats.path_name = s->index_to_workdir->old_file.path;
+        if (options.prune_loose_objects)
+        {
+            for (const auto& object : loose_objects)
+            {
+                if (fs::remove(object.file, ec))
+                    ++stats.loose_objects_removed;
+                fs::remove(object.file.parent_path(), ec); // only succeeds if empty
+            }
+        }
+    }
 
-            return_array.push_back(filestats);
+#if LIBGIT2_FULLVERSION >= 1002000
+    if (options.write_multi_pack_index)
+    {
+        git_midx_writer* raw_writer;
+        int error = git_midx_writer_new(&raw_writer, pack_dir.string().c_str());
+        if (error)
+        {
+            throw Error{ error, cat("Cannot create multi-pack-index writer: ",
+                git_error_last()->message) };
+        }
+        std::unique_ptr<git_midx_writer, void(*)(git_midx_writer*)>
+            writer{ raw_writer, git_midx_writer_free };
 
-            continue;
+        std::error_code ec;
+        for (const auto& file : fs::directory_iterator{ pack_dir, ec })
+        {
+            if (file.path().extension() != ".idx")
+                continue;
+
+            error = git_midx_writer_add(writer.get(), file.path().filename().string().c_str());
+            if (error)
+                throw Error{ error, cat("Cannot add pack index: ", git_error_last()->message) };
         }
 
-        // list ignored files
-        //####################
-        if (s->status == GIT_STATUS_IGNORED) {
+        error = git_midx_writer_commit(writer.get());
+        if (error)
+        {
+            throw Error{ error, cat("Cannot write multi-pack-index: ",
+                git_error_last()->message) };
+        }
+    }
 
-            filestats.handling = "ignored";
-            filestats.changes = "ignored";
-            filestats.path_name = s->index_to_workdir->old_file.path;
+    if (options.write_commit_graph)
+        write_commit_graph();
+#endif
 
-            return_array.push_back(filestats);
+    stats.duration = std::chrono::steady_clock::now() - start_time;
+    return stats;
+}
 
-            continue;
+bool Repository::is_descendant_of(const std::string& commit, const std::string& ancestor)
+{
+    const git_oid commit_id = resolve_commit(commit);
+    const git_oid ancestor_id = resolve_commit(ancestor);
+
+    int result = git_graph_descendant_of(repo_.get(), &commit_id, &ancestor_id);
+    if (result < 0)
+        throw Error{ result, cat("Cannot determine ancestry: ", git_error_last()->message) };
+    return result == 1;
+}
+
+git_oid Repository::merge_base(const std::string& rev_a, const std::string& rev_b)
+{
+    const git_oid a = resolve_commit(rev_a);
+    const git_oid b = resolve_commit(rev_b);
+
+    git_oid base;
+    int error = git_merge_base(&base, repo_.get(), &a, &b);
+    if (error)
+    {
+        throw Error{ error, cat("Cannot find merge base of \"", rev_a, "\" and \"", rev_b,
+            "\": ", git_error_last()->message) };
+    }
+    return base;
+}
+
+AheadBehind Repository::ahead_behind(const std::string& local, const std::string& upstream)
+{
+    const auto key = std::make_pair(Oid{ resolve_commit(local) },
+        Oid{ resolve_commit(upstream) });
+
+    auto cached = ahead_behind_cache_.find(key);
+    if (cached != ahead_behind_cache_.end())
+        return cached->second;
+
+    std::size_t ahead = 0;
+    std::size_t behind = 0;
+    int error = git_graph_ahead_behind(&ahead, &behind, repo_.get(), &key.first.get(),
+        &key.second.get());
+    if (error)
+    {
+        throw Error{ error, cat("Cannot compare \"", local, "\" with \"", upstream, "\": ",
+            git_error_last()->message) };
+    }
+
+    if (ahead_behind_cache_.size() >= max_ahead_behind_cache_size)
+        ahead_behind_cache_.clear();
+
+    const AheadBehind result{ ahead, behind };
+    ahead_behind_cache_.emplace(key, result);
+    return result;
+}
+
+bool Repository::branch_up_to_date(const std::string& branch_name)
+{
+    auto local_ref = branch_lookup(repo_.get(), branch_name, GIT_BRANCH_LOCAL);
+    if (not local_ref)
+    {
+        throw Error{ cat("Cannot find local branch \"", branch_name, "\": ",
+            git_error_last()->message) };
+    }
+
+    git_reference* upstream_ptr = nullptr;
+    int error = git_branch_upstream(&upstream_ptr, local_ref.get());
+    if (error)
+    {
+        throw Error{ error, cat("Cannot find upstream of branch \"", branch_name, "\": ",
+            git_error_last()->message) };
+    }
+    LibGitReference upstream_ref{ upstream_ptr, git_reference_free };
+
+    return ahead_behind(reference_name(local_ref.get()),
+        reference_name(upstream_ref.get())).up_to_date();
+}
+
+std::vector<CommitInfo> Repository::log(const std::filesystem::path& path,
+    std::size_t limit)
+{
+    const std::string path_str = path.generic_string();
+    if (path_str.empty())
+        throw Error{ "log: Path must not be empty" };
+
+    const Oid head_id = head_oid();
+    if (head_id.is_zero())
+        return { };
+
+    // A cached result can be used if HEAD has not moved and it covers the limit
+    auto cached = log_cache_.find(path_str);
+    if (cached != log_cache_.end() && cached->second.head == head_id)
+    {
+        const auto& entry = cached->second;
+        const bool complete = entry.limit == 0 || entry.commits.size() < entry.limit;
+        if (complete || (limit != 0 && limit <= entry.limit))
+        {
+            const auto n = limit == 0 ? entry.commits.size()
+                                      : std::min(limit, entry.commits.size());
+            return { entry.commits.begin(), entry.commits.begin() + n };
         }
     }
-    return return_array;
+
+    // Tree entry IDs of the path by commit ID; every commit is visited as a child and
+    // as a parent, so each ID is only determined once.
+    std::unordered_map<Oid, Oid> entry_ids;
+    auto get_entry_id = [&](const git_commit* commit) -> Oid
+        {
+            auto it = entry_ids.find(*git_commit_id(commit));
+            if (it == entry_ids.end())
+            {
+                it = entry_ids.emplace(*git_commit_id(commit),
+                    tree_entry_id(commit, path_str)).first;
+            }
+            return it->second;
+        };
+
+    CommitRangeOptions options;
+    options.topological = true;
+    options.time = true;
+
+    std::vector<CommitInfo> result;
+
+    for (const auto& view : commits(options))
+    {
+        git_commit* commit = view.get();
+        const Oid entry_id = get_entry_id(commit);
+        const unsigned int num_parents = git_commit_parentcount(commit);
+
+        bool changed = num_parents == 0 && not entry_id.is_zero();
+        for (unsigned int i = 0; i != num_parents; ++i)
+        {
+            git_commit* parent;
+            int error = git_commit_parent(&parent, commit, i);
+            if (error)
+                throw Error{ error, cat("log: Cannot find parent of ", view.id_string()) };
+            LibGitCommit parent_owner{ parent, git_commit_free };
+
+            // A commit is only reported if it differs from all of its parents
+            changed = entry_id != get_entry_id(parent);
+            if (not changed)
+                break;
+        }
+
+        if (changed)
+        {
+            result.push_back(view.to_commit_info());
+            if (limit != 0 && result.size() == limit)
+                break;
+        }
+
+        // Entries of visited commits are no longer needed
+        entry_ids.erase(view.id());
+    }
+
+    if (log_cache_.size() >= max_log_cache_size)
+        log_cache_.clear();
+    log_cache_[path_str] = LogCacheEntry{ head_id, limit, result };
+
+    return result;
 }
 
-RepoState Repository::status()
+LibGitStatusList Repository::make_status_list(const StatusOptions& options)
 {
     git_status_options status_opt = GIT_STATUS_OPTIONS_INIT;
-    status_opt.flags =  GIT_STATUS_OPT_INCLUDE_UNTRACKED |          // untracked files
-                        GIT_STATUS_OPT_RECURSE_UNTRACKED_DIRS |     // untracked directories
-                        GIT_STATUS_OPT_INCLUDE_UNMODIFIED |         // unmodified files
-                        GIT_STATUS_OPT_INCLUDE_IGNORED;             // ignored files
+    status_opt.flags = 0;
+
+    if (options.include_untracked)
+        status_opt.flags |= GIT_STATUS_OPT_INCLUDE_UNTRACKED;
+    if (options.include_untracked && options.recurse_untracked_dirs)
+        status_opt.flags |= GIT_STATUS_OPT_RECURSE_UNTRACKED_DIRS;
+    if (options.include_unmodified)
+        status_opt.flags |= GIT_STATUS_OPT_INCLUDE_UNMODIFIED;
+    if (options.include_ignored)
+        status_opt.flags |= GIT_STATUS_OPT_INCLUDE_IGNORED;
+    if (options.detect_renames)
+    {
+        status_opt.flags |= GIT_STATUS_OPT_RENAMES_HEAD_TO_INDEX
+                         |  GIT_STATUS_OPT_RENAMES_INDEX_TO_WORKDIR;
+    }
+    if (options.pathspec_literal)
+        status_opt.flags |= GIT_STATUS_OPT_DISABLE_PATHSPEC_MATCH;
+
+    // transform std::string input into readable data for libgit2
+    std::vector<const char*> pathspec_as_cstr;
+    pathspec_as_cstr.reserve(options.pathspec.size());
+    for (const auto& path : options.pathspec)
+        pathspec_as_cstr.push_back(path.c_str());
+    status_opt.pathspec.strings = const_cast<char**>(pathspec_as_cstr.data());
+    status_opt.pathspec.count = pathspec_as_cstr.size();
 
     auto my_status = status_list_new(repo_.get(), status_opt);
     if (not my_status)
-        throw Error{ "Cannot initialize status" };
+        throw Error{ cat("Cannot initialize status: ", git_error_last()->message) };
 
-    return collect_status(my_status);
+    return my_status;
 }
 
 std::vector<int> Repository::add_files(const std::vector<std::filesystem::path>& filepaths)
 {
-    auto gindex = repository_index(repo_.get());
+    auto gindex = get_index();
 
     size_t v_len = filepaths.size();
 
     std::vector<int> error_list;
     for (size_t i = 0; i < v_len; i++)
     {
-        int error = git_index_add_bypath(gindex.get(), filepaths[i].c_str());
+        int error = git_index_add_bypath(gindex, filepaths[i].c_str());
         if (error)
             error_list.push_back(i);
     }
 
-    git_index_write(gindex.get());
+    index_modified();
 
     return error_list;
 }
 
+void Repository::stage_buffer(const std::filesystem::path& path, std::string_view content,
+    git_filemode_t mode)
+{
+    const std::string path_str = path.generic_string();
+
+    git_oid blob_id;
+    int error = git_blob_create_from_buffer(&blob_id, repo_.get(), content.data(),
+        content.size());
+    if (error)
+    {
+        throw Error{ error, cat("Cannot create blob for \"", path_str, "\": ",
+            git_error_last()->message) };
+    }
+
+    git_index_entry entry{ };
+    entry.mode = mode;
+    entry.id = blob_id;
+    entry.file_size = static_cast<uint32_t>(content.size());
+    entry.path = path_str.c_str();
+
+    error = git_index_add(get_index(), &entry);
+    if (error)
+    {
+        throw Error{ error, cat("Cannot stage \"", path_str, "\": ",
+            git_error_last()->message) };
+    }
+
+    index_modified();
+}
+
 void Repository::reset(unsigned int nr_of_commits)
 {
     auto parent_commit = get_commit(nr_of_commits);
+
+    // A hard reset replaces the index, so pending modifications are dropped
+    invalidate_index();
+
     auto error = git_reset(repo_.get(), reinterpret_cast<git_object*>(parent_commit.get()), GIT_RESET_HARD, nullptr);
     if (error)
         throw Error{ cat("Reset: ", git_error_last()->message) };
@@ -491,6 +1461,13 @@ std::vector<std::string> Repository::list_remote_names() const
 }
 
 void Repository::push(const Remote& remote, const std::string& refspec)
+{
+    PushOptions options;
+    options.refspecs = { refspec };
+    push(remote, options);
+}
+
+PushStats Repository::push(const Remote& remote, const PushOptions& options)
 {
     git_remote_callbacks callbacks;
     int error = git_remote_init_callbacks(&callbacks, GIT_REMOTE_CALLBACKS_VERSION);
@@ -499,7 +1476,13 @@ void Repository::push(const Remote& remote, const std::string& refspec)
         throw Error{ cat("Cannot initialize remote callbacks for push: ",
             git_error_last()->message) };
     }
+
+    PushPayload payload{ options.progress, std::chrono::steady_clock::now(), { },
+        nullptr };
+
     callbacks.credentials = get_dummy_credentials_callback();
+    callbacks.push_transfer_progress = push_progress_callback;
+    callbacks.payload = &payload;
 
     git_push_options push_options;
     error = git_push_init_options(&push_options, GIT_PUSH_OPTIONS_VERSION);
@@ -507,92 +1490,102 @@ void Repository::push(const Remote& remote, const std::string& refspec)
         throw Error{ cat("Init push: ", git_error_last()->message) };
     push_options.callbacks = callbacks;
 
-    char* refspec_ptr = const_cast<char*>(refspec.c_str());
-    const git_strarray refspec_array = {
-        &refspec_ptr,
-        1
-    };
+    std::vector<char*> refspec_ptrs;
+    refspec_ptrs.reserve(options.refspecs.size());
+    for (const auto& refspec : options.refspecs)
+        refspec_ptrs.push_back(const_cast<char*>(refspec.c_str()));
+    const git_strarray refspec_array = { refspec_ptrs.data(), refspec_ptrs.size() };
+
+    const git_strarray* refspecs = options.refspecs.empty() ? nullptr : &refspec_array;
+
+    if (remote.claim_connection(Direction::push))
+    {
+        // Reuse the open connection; git_remote_push() would close it afterwards
+        error = git_remote_upload(remote.get(), refspecs, &push_options);
+        if (not error)
+        {
+            error = git_remote_update_tips(remote.get(), &callbacks, 0,
+                GIT_REMOTE_DOWNLOAD_TAGS_UNSPECIFIED, nullptr);
+        }
+    }
+    else
+    {
+        error = git_remote_push(remote.get(), refspecs, &push_options);
+    }
 
-    error = git_remote_push(remote.get(), &refspec_array, &push_options);
+    if (payload.exception)
+        std::rethrow_exception(payload.exception);
     if (error)
-        throw Error{ cat("Push remote: ", git_error_last()->message) };
+        throw Error{ error, cat("Push remote: ", git_error_last()->message) };
+
+    payload.stats.duration = std::chrono::steady_clock::now() - payload.start_time;
+    return payload.stats;
 }
 
-#if 0
-void Repository::pull()
+FetchStats Repository::fetch(const Remote& remote, const FetchOptions& options)
 {
-    // define fetch options
-    git_fetch_options options = GIT_FETCH_OPTIONS_INIT;
-
-    // set remote
-    /*
-    auto remote = remote_lookup(repo_.get(), "origin");
-    if (not remote)
-        throw Error{ "Cannot find remote object" };
-    */
-
-    // fetch commits from remote connection
-    int error = git_remote_fetch(remote_.get(), NULL, &options, NULL);
+    git_fetch_options fetch_options;
+    int error = git_fetch_init_options(&fetch_options, GIT_FETCH_OPTIONS_VERSION);
     if (error)
-        throw Error{ cat("Pull: ", git_error_last()->message) };
+        throw Error{ cat("Init fetch: ", git_error_last()->message) };
 
-    // git_apply, if failed git_merge
-    // TODO
+    FetchPayload payload{ options.progress, std::chrono::steady_clock::now(), nullptr };
 
-    //cleanup repository from remote connection and merge/fetch pointers
-    git_repository_state_cleanup(repo_.get());
+    fetch_options.callbacks.credentials = get_dummy_credentials_callback();
+    if (options.progress)
+    {
+        fetch_options.callbacks.transfer_progress = fetch_progress_callback;
+        fetch_options.callbacks.payload = &payload;
+    }
+    fetch_options.prune = options.prune ? GIT_FETCH_PRUNE : GIT_FETCH_PRUNE_UNSPECIFIED;
+    fetch_options.download_tags = to_autotag_option(options.tags);
 
+    if (options.depth > 0)
+    {
+#if LIBGIT2_FULLVERSION >= 1007000
+        fetch_options.depth = static_cast<int>(options.depth);
+#else
+        throw Error{ "Shallow fetches require libgit2 1.7 or newer" };
+#endif
+    }
 
-}
+    std::vector<char*> refspec_ptrs;
+    refspec_ptrs.reserve(options.refspecs.size());
+    for (const auto& refspec : options.refspecs)
+        refspec_ptrs.push_back(const_cast<char*>(refspec.c_str()));
+    const git_strarray refspec_array = { refspec_ptrs.data(), refspec_ptrs.size() };
 
-void Repository::clone_repo(const std::string& url, const std::filesystem::path& repo_path)
-{
-    auto repo = clone(url, repo_path);
-    if (not repo) {
-        throw Error{ "Cannot clone repository" };
+    const git_strarray* refspecs = options.refspecs.empty() ? nullptr : &refspec_array;
+
+    if (remote.claim_connection(Direction::fetch))
+    {
+        // Reuse the open connection; git_remote_fetch() would close it afterwards
+        error = git_remote_download(remote.get(), refspecs, &fetch_options);
+        if (not error)
+        {
+            error = git_remote_update_tips(remote.get(), &fetch_options.callbacks, 1,
+                fetch_options.download_tags, nullptr);
+        }
+        // Same rule as git_remote_fetch(): prune if requested or configured
+        if (not error && (options.prune || git_remote_prune_refs(remote.get())))
+            error = git_remote_prune(remote.get(), &fetch_options.callbacks);
     }
     else
     {
-        url_ = url;
-        remote_ = remote_lookup(repo.get(), "origin"); // TODO: origin korrekt?
-        repo_path_ = repo_path;
-        repo_ = std::move(repo);
-
+        error = git_remote_fetch(remote.get(), refspecs, &fetch_options, nullptr);
     }
-}
 
-bool Repository::branch_up_to_date(const std::string& branch_name)
-{
-    auto local_ref = branch_lookup(repo_.get(), "master", GIT_BRANCH_LOCAL);
-    if (not local_ref)
-        throw Error{ cat("Branch lookup: ", git_error_last()->message) };
-
-    // Get the name of the remote associated with the local branch
-    //TODO: wrapper for buffer?
-    auto remote_name = branch_remote_name(repo_.get(), branch_name.c_str());
-    if (remote_name == "")
-        throw Error{ "Failed to get remote name for the local branch" };
-
-    // Open the remote
-    auto remote = remote_lookup(repo_.get(), remote_name);
-    if (not remote)
-        throw Error{ "Cannot find remote object" };
-
-    // Get the upstream branch
-    git_reference* upstream_ref = nullptr;
-    if (git_branch_upstream(&upstream_ref, local_ref.get()) != 0) {
-        std::cerr << "Failed to get upstream branch." << std::endl;
-        return 1;
+    if (payload.exception)
+        std::rethrow_exception(payload.exception);
+    if (error)
+    {
+        throw Error{ error, cat("Cannot fetch from remote \"", remote.get_name(), "\": ",
+            git_error_last()->message) };
     }
 
-    // Get the OIDs of the local and remote branches
-    const git_oid* local_oid = git_reference_target(local_ref.get());
-    const git_oid* remote_oid = git_reference_target(upstream_ref);
-
-    // Compare OIDs to check if the branches are up to date
-    return git_oid_equal(local_oid, remote_oid);
+    return to_fetch_stats(*git_remote_stats(remote.get()), payload.start_time);
 }
-#endif
+
 
 
 LibGitReference Repository::new_branch(const std::string& branch_name)
@@ -669,6 +1662,10 @@ void Repository::checkout(const std::string& branch_name,
         parse_reference_from_name(repo_.get(), branch_name).get());
     auto last_commit = get_commit(full_branch_name);
 
+    // libgit2 reloads the index from disk during a forced checkout
+    write_index();
+    invalidate_index();
+
     // checkout (the cast is necessary because libgit2 simulates inheritance by having a
     // struct git_object as the first member of the opaque struct git_commit)
     auto error = git_checkout_tree(repo_.get(),
@@ -0,0 +1,99 @@
+/**
+ * \file   StatusList.cc
+ * \date   Created on October 16, 2026
+ * \brief  Implementation of the StatusList class.
+ *
+ * \copyright Copyright 2026 Deutsches Elektronen-Synchrotron (DESY), Hamburg
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation, either version 2.1 of the license, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <cstring>
+
+#include <git2.h>
+#include <gul14/cat.h>
+
+#include "libgit4cpp/Error.h"
+#include "libgit4cpp/StatusList.h"
+#include "status_entry.h"
+
+using gul14::cat;
+
+namespace git {
+
+CompactFileStatus FileStatusView::to_compact_file_status() const
+{
+    if (old_path_name.empty())
+        return CompactFileStatus{ std::string{ path_name }, handling, changes };
+
+    return CompactFileStatus{ cat(old_path_name, " -> ", path_name), handling, changes };
+}
+
+FileStatus FileStatusView::to_file_status() const
+{
+    return git::to_file_status(to_compact_file_status());
+}
+
+void StatusList::const_iterator::skip_to_valid()
+{
+    DecodedStatusEntry entry;
+
+    for (; index_ < size_; ++index_)
+    {
+        if (not decode_status_entry(git_status_byindex(list_, index_), entry))
+            continue;
+
+        const char* path = entry.new_path ? entry.new_path : entry.old_path;
+        view_.path_name = path ? path : "";
+
+        if (entry.old_path && entry.new_path && std::strcmp(entry.old_path, entry.new_path))
+            view_.old_path_name = entry.old_path;
+        else
+            view_.old_path_name = std::string_view{ };
+
+        view_.handling = entry.handling;
+        view_.changes = entry.changes;
+        return;
+    }
+}
+
+StatusList::StatusList(LibGitStatusList&& status_list)
+    : list_{ std::move(status_list) }
+{
+    if (list_ == nullptr)
+        throw Error{ "Status list pointer may not be null" };
+
+    size_ = git_status_list_entrycount(list_.get());
+
+    DecodedStatusEntry entry;
+    for (std::size_t i = 0; i != size_; ++i)
+    {
+        if (decode_status_entry(git_status_byindex(list_.get(), i), entry))
+            ++num_entries_;
+    }
+}
+
+StatusList::const_iterator StatusList::begin() const
+{
+    return const_iterator{ list_.get(), 0, size_ };
+}
+
+StatusList::const_iterator StatusList::end() const
+{
+    return const_iterator{ list_.get(), size_, size_ };
+}
+
+} // namespace git
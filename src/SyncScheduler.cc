@@ -0,0 +1,172 @@
+/**
+ * \file   SyncScheduler.cc
+ * \date   Created on October 16, 2026
+ * \brief  Implementation of the SyncScheduler class.
+ *
+ * \copyright Copyright 2026 Deutsches Elektronen-Synchrotron (DESY), Hamburg
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation, either version 2.1 of the license, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <thread>
+
+#include <git2.h>
+#include <gul14/cat.h>
+
+#include "libgit4cpp/Error.h"
+#include "libgit4cpp/Repository.h"
+#include "libgit4cpp/SyncScheduler.h"
+
+using gul14::cat;
+
+namespace git {
+
+namespace {
+
+/// Execute a single job and catch all errors.
+SyncResult run_job(const SyncJob& job, std::chrono::steady_clock::duration timeout)
+{
+    const auto start_time = std::chrono::steady_clock::now();
+
+    auto expired = [start_time, timeout]()
+        {
+            return timeout.count() > 0
+                && std::chrono::steady_clock::now() - start_time >= timeout;
+        };
+
+    SyncResult result;
+
+    // Set by the progress callbacks when they cancel the transfer
+    bool cancelled = false;
+    auto keep_going = [&expired, &cancelled]()
+        {
+            if (expired())
+                cancelled = true;
+            return not cancelled;
+        };
+
+    try
+    {
+        auto repo = Repository::open(job.repository);
+        auto remote = repo.get_remote(job.remote);
+        if (not remote)
+        {
+            throw Error{ GIT_ENOTFOUND, cat("Remote \"", job.remote,
+                "\" not found in repository ", job.repository.string()) };
+        }
+
+        if (job.direction == SyncDirection::fetch)
+        {
+            FetchOptions options;
+            options.refspecs = job.refspecs;
+            options.progress = [&keep_going](const FetchStats&) { return keep_going(); };
+
+            const auto stats = repo.fetch(*remote, options);
+            result.objects = stats.received_objects;
+            result.bytes = stats.received_bytes;
+        }
+        else
+        {
+            PushOptions options;
+            options.refspecs = job.refspecs;
+            options.progress = [&keep_going](const PushStats&) { return keep_going(); };
+
+            const auto stats = repo.push(*remote, options);
+            result.objects = stats.sent_objects;
+            result.bytes = stats.sent_bytes;
+        }
+
+        result.success = true;
+    }
+    catch (const std::exception& e)
+    {
+        result.error = e.what();
+        result.timed_out = cancelled;
+    }
+    catch (...)
+    {
+        result.error = "Unknown exception";
+    }
+
+    result.duration = std::chrono::steady_clock::now() - start_time;
+    return result;
+}
+
+} // anonymous namespace
+
+SyncScheduler::SyncScheduler(unsigned int num_threads)
+    : num_threads_{ num_threads ? num_threads : std::thread::hardware_concurrency() }
+{
+    if (num_threads_ == 0)
+        num_threads_ = 1;
+}
+
+void SyncScheduler::add_job(SyncJob job)
+{
+    jobs_.push_back(std::move(job));
+}
+
+SyncReport SyncScheduler::run() const
+{
+    const auto start_time = std::chrono::steady_clock::now();
+
+    SyncReport report;
+    report.results.resize(jobs_.size());
+
+    // Every worker takes the next unprocessed job until none are left
+    std::atomic<std::size_t> next_job{ 0 };
+    auto worker = [this, &report, &next_job]()
+        {
+            for (auto i = next_job++; i < jobs_.size(); i = next_job++)
+                report.results[i] = run_job(jobs_[i], timeout_);
+        };
+
+    const auto num_workers = std::min<std::size_t>(num_threads_, jobs_.size());
+    std::vector<std::thread> threads;
+    threads.reserve(num_workers);
+
+    try
+    {
+        for (std::size_t i = 0; i != num_workers; ++i)
+            threads.emplace_back(worker);
+    }
+    catch (...)
+    {
+        // Let the threads that did start finish the remaining jobs
+        if (threads.empty())
+            throw;
+    }
+
+    for (auto& thread : threads)
+        thread.join();
+
+    for (const auto& result : report.results)
+    {
+        if (not result.success)
+            ++report.num_failed;
+        if (result.timed_out)
+            ++report.num_timed_out;
+        report.bytes += result.bytes;
+    }
+
+    report.wall_time = std::chrono::steady_clock::now() - start_time;
+    return report;
+}
+
+} // namespace git
@@ -0,0 +1,287 @@
+/**
+ * \file   TreeBuilder.cc
+ * \date   Created on October 16, 2026
+ * \brief  Implementation of the TreeBuilder class.
+ *
+ * \copyright Copyright 2026 Deutsches Elektronen-Synchrotron (DESY), Hamburg
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation, either version 2.1 of the license, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <algorithm>
+
+#include <git2.h>
+#include <gul14/cat.h>
+
+#include "libgit4cpp/Error.h"
+#include "libgit4cpp/TreeBuilder.h"
+#include "libgit4cpp/wrapper_functions.h"
+
+using gul14::cat;
+
+namespace git {
+
+namespace {
+
+/**
+ * Remove leading and trailing slashes from a path and check that it consists of valid
+ * components.
+ * \exception Error is thrown if the path is empty or contains empty, "." or ".."
+ *            components.
+ */
+std::string normalize_path(const std::string& path)
+{
+    const auto first = path.find_first_not_of('/');
+    if (first == std::string::npos)
+        throw Error{ cat("Invalid path \"", path, "\"") };
+
+    const auto last = path.find_last_not_of('/');
+    std::string result = path.substr(first, last - first + 1);
+
+    std::size_t pos = 0;
+    while (pos <= result.size())
+    {
+        auto end = result.find('/', pos);
+        if (end == std::string::npos)
+            end = result.size();
+
+        const auto component = result.substr(pos, end - pos);
+        if (component.empty() || component == "." || component == ".." || component == ".git")
+            throw Error{ cat("Invalid path \"", path, "\"") };
+
+        pos = end + 1;
+    }
+
+    return result;
+}
+
+} // anonymous namespace
+
+TreeBuilder::TreeBuilder(Repository& repo, const std::string& base_revision)
+    : repo_{ repo }
+{
+    if (base_revision.empty())
+        return;
+
+    auto obj = revparse_single(repo_.get_repo(), base_revision);
+    if (not obj)
+    {
+        throw Error{ cat("Cannot resolve revision \"", base_revision, "\": ",
+            git_error_last()->message) };
+    }
+
+    git_object* tree = nullptr;
+    int error = git_object_peel(&tree, obj.get(), GIT_OBJECT_TREE);
+    if (error)
+    {
+        throw Error{ error, cat("Revision \"", base_revision, "\" has no tree: ",
+            git_error_last()->message) };
+    }
+    base_tree_.reset(reinterpret_cast<git_tree*>(tree));
+}
+
+void TreeBuilder::insert(const std::string& path, std::string_view content,
+    git_filemode_t mode)
+{
+    const auto norm_path = normalize_path(path);
+
+    // A pending file cannot have children
+    for (auto slash = norm_path.find('/'); slash != std::string::npos;
+         slash = norm_path.find('/', slash + 1))
+    {
+        auto parent = modifications_.find(norm_path.substr(0, slash));
+        if (parent != modifications_.end() && not parent->second.remove)
+        {
+            throw Error{ GIT_EEXISTS, cat("Cannot insert \"", norm_path, "\": \"",
+                parent->first, "\" is a file") };
+        }
+    }
+
+    // A directory with pending files cannot become a file; pending removals below the
+    // path are superseded by the new file
+    const auto below = find_below(norm_path);
+    for (auto it = below.first; it != below.second; ++it)
+    {
+        if (not it->second.remove)
+        {
+            throw Error{ GIT_EEXISTS, cat("Cannot insert \"", norm_path,
+                "\": it is a directory containing \"", it->first, "\"") };
+        }
+    }
+    modifications_.erase(below.first, below.second);
+
+    Modification mod;
+    mod.mode = mode;
+
+    int error = git_blob_create_from_buffer(&mod.id, repo_.get_repo(), content.data(),
+        content.size());
+    if (error)
+    {
+        throw Error{ error, cat("Cannot create blob for \"", path, "\": ",
+            git_error_last()->message) };
+    }
+
+    modifications_[norm_path] = mod;
+}
+
+void TreeBuilder::remove(const std::string& path)
+{
+    const auto norm_path = normalize_path(path);
+
+    // Earlier modifications below the removed path are void
+    const auto below = find_below(norm_path);
+    modifications_.erase(below.first, below.second);
+
+    Modification mod;
+    mod.remove = true;
+    modifications_[norm_path] = mod;
+}
+
+std::pair<TreeBuilder::Modifications::iterator, TreeBuilder::Modifications::iterator>
+TreeBuilder::find_below(const std::string& path)
+{
+    const std::string dir_prefix = path + "/";
+    const auto begin = modifications_.lower_bound(dir_prefix);
+    auto end = begin;
+    while (end != modifications_.end()
+        && end->first.compare(0, dir_prefix.size(), dir_prefix) == 0)
+    {
+        ++end;
+    }
+    return { begin, end };
+}
+
+git_oid TreeBuilder::write()
+{
+    bool is_empty;
+    return build_tree(base_tree_.get(), modifications_.cbegin(), modifications_.cend(), 0,
+        is_empty);
+}
+
+git_oid TreeBuilder::commit(const std::string& ref, const std::string& message)
+{
+    return repo_.create_commit(write(), message, ref);
+}
+
+git_oid TreeBuilder::build_tree(const git_tree* base, Modifications::const_iterator begin,
+    Modifications::const_iterator end, std::size_t prefix_len, bool& is_empty)
+{
+    auto builder = treebuilder_new(repo_.get_repo(), base);
+    if (not builder)
+        throw Error{ cat("Cannot create tree builder: ", git_error_last()->message) };
+
+    auto it = begin;
+    while (it != end)
+    {
+        const std::string& path = it->first;
+        const auto slash = path.find('/', prefix_len);
+        int error = 0;
+
+        if (slash == std::string::npos)
+        {
+            // A file (or a directory to be removed) on this level
+            const char* name = path.c_str() + prefix_len;
+            const Modification& mod = it->second;
+
+            if (not mod.remove)
+                error = git_treebuilder_insert(nullptr, builder.get(), name, &mod.id, mod.mode);
+            else if (git_treebuilder_get(builder.get(), name))
+                error = git_treebuilder_remove(builder.get(), name);
+
+            if (error)
+            {
+                throw Error{ error, cat("Cannot modify tree entry \"", path, "\": ",
+                    git_error_last()->message) };
+            }
+
+            ++it;
+            continue;
+        }
+
+        // All modifications below the same subdirectory form a contiguous range
+        const std::string dir_prefix = path.substr(0, slash + 1);
+        const auto sub_end = std::find_if(it, end,
+            [&dir_prefix](const Modifications::value_type& m)
+            {
+                return m.first.compare(0, dir_prefix.size(), dir_prefix) != 0;
+            });
+        const std::string name = path.substr(prefix_len, slash - prefix_len);
+
+        LibGitTree sub_base{ nullptr, git_tree_free };
+        const git_tree_entry* entry = git_treebuilder_get(builder.get(), name.c_str());
+        const bool entry_exists = (entry != nullptr);
+
+        if (entry && git_tree_entry_type(entry) != GIT_OBJECT_TREE)
+        {
+            // An existing file is only replaced by a directory if it is removed first
+            const auto insertion = std::find_if(it, sub_end,
+                [](const Modifications::value_type& m) { return not m.second.remove; });
+            if (insertion != sub_end)
+            {
+                throw Error{ GIT_EEXISTS, cat("Cannot insert \"", insertion->first,
+                    "\": \"", dir_prefix.substr(0, dir_prefix.size() - 1),
+                    "\" is a file") };
+            }
+
+            // Removing paths below a file has no effect
+            it = sub_end;
+            continue;
+        }
+        if (entry && git_tree_entry_type(entry) == GIT_OBJECT_TREE)
+        {
+            sub_base = tree_lookup(repo_.get_repo(), *git_tree_entry_id(entry));
+            if (not sub_base)
+            {
+                throw Error{ cat("Cannot look up tree \"", dir_prefix, "\": ",
+                    git_error_last()->message) };
+            }
+        }
+
+        bool sub_is_empty;
+        const git_oid sub_id = build_tree(sub_base.get(), it, sub_end, slash + 1,
+            sub_is_empty);
+
+        // git does not store empty directories
+        if (not sub_is_empty)
+        {
+            error = git_treebuilder_insert(nullptr, builder.get(), name.c_str(), &sub_id,
+                GIT_FILEMODE_TREE);
+        }
+        else if (entry_exists)
+        {
+            error = git_treebuilder_remove(builder.get(), name.c_str());
+        }
+
+        if (error)
+        {
+            throw Error{ error, cat("Cannot modify tree entry \"", dir_prefix, "\": ",
+                git_error_last()->message) };
+        }
+
+        it = sub_end;
+    }
+
+    is_empty = (git_treebuilder_entrycount(builder.get()) == 0);
+
+    git_oid tree_id;
+    int error = git_treebuilder_write(&tree_id, builder.get());
+    if (error)
+        throw Error{ error, cat("Cannot write tree: ", git_error_last()->message) };
+
+    return tree_id;
+}
+
+} // namespace git
@@ -0,0 +1,64 @@
+/**
+ * \file   status_entry.h
+ * \date   Created on October 16, 2026
+ * \brief  Declaration of the decoder for libgit2 status entries.
+ *
+ * \copyright Copyright 2023-2026 Deutsches Elektronen-Synchrotron (DESY), Hamburg
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation, either version 2.1 of the license, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#ifndef LIBGIT4CPP_STATUS_ENTRY_H_
+#define LIBGIT4CPP_STATUS_ENTRY_H_
+
+#include <string>
+
+#include <git2.h>
+
+#include "libgit4cpp/FileStatus.h"
+
+namespace git {
+
+/// Status of one file as decoded from a git_status_entry; the paths point into libgit2.
+struct DecodedStatusEntry
+{
+    Handling handling = Handling::unchanged;
+    Change changes = Change::unchanged;
+    const char* old_path = nullptr;
+    const char* new_path = nullptr;
+};
+
+/**
+ * Translate the status flags of a libgit2 status entry into handling and change status.
+ *
+ * Unstaged changes take precedence over staged ones. Entries with a combination of flags
+ * that is not represented by Handling/Change (e.g. conflicts) are not decoded.
+ *
+ * \param s    Status entry from a git_status_list
+ * \param out  Is filled with the decoded status if the function returns true
+ * \return true if the entry was decoded, false if it should be skipped.
+ */
+bool decode_status_entry(const git_status_entry* s, DecodedStatusEntry& out) noexcept;
+
+/**
+ * Return the path of a decoded entry in the form used by FileStatus::path_name: If the
+ * file was renamed, the shape is "OLD_NAME -> NEW_NAME".
+ */
+std::string format_path_name(const DecodedStatusEntry& entry);
+
+} // namespace git
+
+#endif
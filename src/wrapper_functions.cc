@@ -34,7 +34,8 @@ namespace git {
 LibGitRepository repository_open(const std::string& repo_path)
 {
     git_repository* repo;
-    if (git_repository_open(&repo, repo_path.c_str()))
+    if (git_repository_open_ext(&repo, repo_path.c_str(), GIT_REPOSITORY_OPEN_NO_SEARCH,
+            nullptr))
     {
         // gul14::cat("repository_open: ", git_error_last()->message);
         repo = nullptr;
@@ -43,14 +44,15 @@ LibGitRepository repository_open(const std::string& repo_path)
     return { repo, git_repository_free };
 }
 
-LibGitRepository repository_init(const std::string& repo_path, bool is_bare)
+LibGitRepository repository_init(const std::string& repo_path, bool is_bare,
+    const std::string& initial_head)
 {
     git_repository_init_options opts;
     git_repository_init_init_options(&opts, GIT_REPOSITORY_INIT_OPTIONS_VERSION);
     if (is_bare)
         opts.flags |= GIT_REPOSITORY_INIT_BARE;
     opts.flags |= GIT_REPOSITORY_INIT_MKPATH;
-    opts.initial_head = "main";
+    opts.initial_head = initial_head.c_str();
     git_repository* repo;
     int error = git_repository_init_ext(&repo, repo_path.c_str(), &opts);
     if (error)
@@ -147,10 +149,11 @@ LibGitReference repository_head(git_repository* repo)
     return { reference, git_reference_free };
 }
 
-LibGitRepository clone(const std::string& url, const std::string& repo_path)
+LibGitRepository clone(const std::string& url, const std::string& repo_path,
+    const git_clone_options* options)
 {
     git_repository* repo;
-    if (git_clone(&repo, url.c_str(), repo_path.c_str(), nullptr))
+    if (git_clone(&repo, url.c_str(), repo_path.c_str(), options))
     {
         // gul14::cat("branch_remote_name: ", git_error_last()->message);
         repo = nullptr;
@@ -243,4 +246,28 @@ LibGitReference branch_next(git_branch_t* branch_type, git_branch_iterator* iter
     return {ref, git_reference_free};
 }
 
+LibGitObject revparse_single(git_repository* repo, const std::string& spec)
+{
+    git_object* obj;
+    if (git_revparse_single(&obj, repo, spec.c_str()))
+        obj = nullptr;
+    return { obj, git_object_free };
+}
+
+LibGitTreeBuilder treebuilder_new(git_repository* repo, const git_tree* source)
+{
+    git_treebuilder* builder;
+    if (git_treebuilder_new(&builder, repo, source))
+        builder = nullptr;
+    return { builder, git_treebuilder_free };
+}
+
+LibGitRevwalk revwalk_new(git_repository* repo)
+{
+    git_revwalk* walk;
+    if (git_revwalk_new(&walk, repo))
+        walk = nullptr;
+    return { walk, git_revwalk_free };
+}
+
 } // namespace git
@@ -0,0 +1,121 @@
+/**
+ * \file   test_BlobView.cc
+ * \date   Created on October 16, 2026
+ * \brief  Test suite for the BlobView class.
+ *
+ * \copyright Copyright 2026 Deutsches Elektronen-Synchrotron (DESY), Hamburg
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation, either version 2.1 of the license, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include <git2.h>
+#include <gul14/catch.h>
+
+#include "libgit4cpp/BlobView.h"
+#include "libgit4cpp/Error.h"
+#include "libgit4cpp/Repository.h"
+#include "test_main.h"
+
+using namespace git;
+using namespace std::literals;
+
+TEST_CASE("BlobView: Constructor", "[BlobView]")
+{
+    REQUIRE_THROWS_AS(BlobView(LibGitBlob{ nullptr, git_blob_free }), git::Error);
+}
+
+TEST_CASE("BlobView: Repository::read_blob()", "[BlobView]")
+{
+    const auto reporoot = unit_test_folder() / "BlobView";
+    std::filesystem::remove_all(reporoot);
+    std::filesystem::create_directories(reporoot / "seq");
+    std::ofstream{ reporoot / "seq" / "step.lua" } << "print('Version 1')\n";
+
+    auto repo = Repository::create(reporoot, InitOptions{ false, true });
+
+    std::ofstream{ reporoot / "seq" / "step.lua" } << "print('Version 2')\n";
+    {
+        std::ofstream f{ reporoot / "binary.dat", std::ios::binary };
+        f << "\0\1\2\3"s;
+    }
+    repo.add();
+    repo.commit("Second version");
+
+    // Change the working directory: read_blob() must not look at it
+    std::ofstream{ reporoot / "seq" / "step.lua" } << "Uncommitted";
+
+    auto blob = repo.read_blob("HEAD~1", "seq/step.lua");
+    REQUIRE(blob.content() == "print('Version 1')\n");
+    REQUIRE(blob.size() == 19);
+    REQUIRE(blob.is_binary() == false);
+
+    REQUIRE(repo.read_blob("HEAD", "seq/step.lua").content() == "print('Version 2')\n");
+    REQUIRE(git_oid_equal(&repo.read_blob("HEAD~1", "seq/step.lua").id(), &blob.id()));
+
+    auto binary = repo.read_blob("HEAD", "binary.dat");
+    REQUIRE(binary.size() == 4);
+    REQUIRE(binary.content() == "\0\1\2\3"sv);
+    REQUIRE(binary.is_binary());
+
+    try
+    {
+        repo.read_blob("HEAD~1", "binary.dat");
+        FAIL("read_blob() should have thrown");
+    }
+    catch (const git::Error& e)
+    {
+        REQUIRE(e.code().value() == GIT_ENOTFOUND);
+    }
+
+    REQUIRE_THROWS_AS(repo.read_blob("HEAD", "seq"), git::Error);
+    REQUIRE_THROWS_AS(repo.read_blob("does_not_exist", "seq/step.lua"), git::Error);
+    REQUIRE_THROWS_AS(repo.read_blob("", "seq/step.lua"), git::Error);
+}
+
+TEST_CASE("BlobView: Repository::read_blobs()", "[BlobView]")
+{
+    const auto reporoot = unit_test_folder() / "BlobView_batch";
+    std::filesystem::remove_all(reporoot);
+    std::filesystem::create_directories(reporoot / "seq" / "sub");
+    std::ofstream{ reporoot / "top.txt" } << "Top";
+    std::ofstream{ reporoot / "seq" / "b.lua" } << "B";
+    std::ofstream{ reporoot / "seq" / "a.lua" } << "A";
+    std::ofstream{ reporoot / "seq" / "sub" / "c.lua" } << "C";
+
+    auto repo = Repository::create(reporoot, InitOptions{ false, true });
+
+    const auto blobs = repo.read_blobs("HEAD",
+        { "seq/b.lua", "top.txt", "seq/sub/c.lua", "seq/a.lua", "seq/b.lua" });
+    REQUIRE(blobs.size() == 5);
+    REQUIRE(blobs[0].content() == "B");
+    REQUIRE(blobs[1].content() == "Top");
+    REQUIRE(blobs[2].content() == "C");
+    REQUIRE(blobs[3].content() == "A");
+    REQUIRE(blobs[4].content() == "B");
+
+    REQUIRE(repo.read_blobs("HEAD", { }).empty());
+
+    REQUIRE_THROWS_AS(repo.read_blobs("HEAD", { "seq/a.lua", "seq/missing.lua" }),
+        git::Error);
+    REQUIRE_THROWS_AS(repo.read_blobs("HEAD", { "missing/a.lua" }), git::Error);
+    REQUIRE_THROWS_AS(repo.read_blobs("HEAD", { "seq/sub" }), git::Error);
+    REQUIRE_THROWS_AS(repo.read_blobs("does_not_exist", { "top.txt" }), git::Error);
+}
@@ -0,0 +1,177 @@
+/**
+ * \file   test_CommitRange.cc
+ * \date   Created on October 16, 2026
+ * \brief  Test suite for the CommitRange class.
+ *
+ * \copyright Copyright 2026 Deutsches Elektronen-Synchrotron (DESY), Hamburg
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation, either version 2.1 of the license, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <filesystem>
+#include <string>
+#include <vector>
+
+#include <git2.h>
+#include <gul14/catch.h>
+#include <gul14/gul.h>
+
+#include "libgit4cpp/CommitRange.h"
+#include "libgit4cpp/Error.h"
+#include "libgit4cpp/Repository.h"
+#include "libgit4cpp/TreeBuilder.h"
+#include "test_main.h"
+
+using namespace git;
+using gul14::cat;
+
+namespace {
+
+const auto reporoot = unit_test_folder() / "CommitRange";
+
+/// Create a bare repository with the commits "Commit 0" to "Commit <n-1>" on main.
+void create_history(Repository& repo, int n)
+{
+    for (int i = 0; i != n; ++i)
+    {
+        TreeBuilder builder{ repo, i == 0 ? "" : "HEAD" };
+        builder.insert("file.txt", cat("Version ", i));
+        builder.commit("HEAD", cat("Commit ", i));
+    }
+}
+
+/// Return the summaries of all commits in the range.
+std::vector<std::string> summaries(CommitRange&& range)
+{
+    std::vector<std::string> result;
+    for (const auto& commit : range)
+        result.emplace_back(commit.summary());
+    return result;
+}
+
+} // anonymous namespace
+
+TEST_CASE("CommitRange: Walk linear history", "[CommitRange]")
+{
+    std::filesystem::remove_all(reporoot);
+    auto repo = Repository::create(reporoot, InitOptions{ true });
+    create_history(repo, 4);
+
+    SECTION("Default options")
+    {
+        REQUIRE(summaries(repo.commits())
+            == std::vector<std::string>{ "Commit 3", "Commit 2", "Commit 1", "Commit 0" });
+    }
+
+    SECTION("Reverse topological order")
+    {
+        CommitRangeOptions opts;
+        opts.topological = true;
+        opts.reverse = true;
+        REQUIRE(summaries(repo.commits(opts))
+            == std::vector<std::string>{ "Commit 0", "Commit 1", "Commit 2", "Commit 3" });
+    }
+
+    SECTION("Hide commits")
+    {
+        CommitRangeOptions opts;
+        opts.hide = { "HEAD~2" };
+        REQUIRE(summaries(repo.commits(opts))
+            == std::vector<std::string>{ "Commit 3", "Commit 2" });
+    }
+
+    SECTION("Revision range")
+    {
+        CommitRangeOptions opts;
+        opts.push = { "HEAD~3..HEAD~1" };
+        REQUIRE(summaries(repo.commits(opts))
+            == std::vector<std::string>{ "Commit 2", "Commit 1" });
+    }
+
+    SECTION("Commit properties")
+    {
+        auto range = repo.commits();
+        auto it = range.begin();
+        REQUIRE(it != range.end());
+        REQUIRE(it->id_string().size() == GIT_OID_HEXSZ);
+        REQUIRE(it->message() == "Commit 3");
+        REQUIRE(it->parent_count() == 1);
+        REQUIRE(it->time() > 0);
+        REQUIRE(it->author_name().empty() == false);
+
+        git_oid head_id;
+        REQUIRE(git_reference_name_to_id(&head_id, repo.get_repo(), "HEAD") == 0);
+        REQUIRE(git_oid_equal(&it->id(), &head_id));
+
+        // The range is single-pass
+        ++it;
+        REQUIRE(range.begin()->summary() == "Commit 2");
+    }
+
+    SECTION("Unknown revision")
+    {
+        CommitRangeOptions opts;
+        opts.push = { "does_not_exist" };
+        REQUIRE_THROWS_AS(repo.commits(opts), git::Error);
+    }
+}
+
+TEST_CASE("CommitRange: First parent only", "[CommitRange]")
+{
+    std::filesystem::remove_all(reporoot);
+    auto repo = Repository::create(reporoot, InitOptions{ true });
+    create_history(repo, 2);
+
+    // Add a commit on a side branch and merge it into main
+    git_oid main_id;
+    REQUIRE(git_reference_name_to_id(&main_id, repo.get_repo(), "HEAD") == 0);
+    git_reference* side_ref = nullptr;
+    REQUIRE(git_reference_create(&side_ref, repo.get_repo(), "refs/heads/side", &main_id,
+        0, "Create side branch") == 0);
+    git_reference_free(side_ref);
+
+    TreeBuilder side{ repo, "side" };
+    side.insert("side.txt", "Side");
+    const git_oid side_id = side.commit("refs/heads/side", "Side commit");
+
+    git_commit* main_commit = nullptr;
+    git_commit* side_commit = nullptr;
+    REQUIRE(git_commit_lookup(&main_commit, repo.get_repo(), &main_id) == 0);
+    REQUIRE(git_commit_lookup(&side_commit, repo.get_repo(), &side_id) == 0);
+    LibGitCommit main_owner{ main_commit, git_commit_free };
+    LibGitCommit side_owner{ side_commit, git_commit_free };
+
+    git_tree* tree = nullptr;
+    REQUIRE(git_commit_tree(&tree, side_commit) == 0);
+    LibGitTree tree_owner{ tree, git_tree_free };
+
+    const git_commit* parents[] = { main_commit, side_commit };
+    git_oid merge_id;
+    REQUIRE(git_commit_create(&merge_id, repo.get_repo(), "HEAD",
+        git_commit_author(main_commit), git_commit_author(main_commit), "UTF-8",
+        "Merge side", tree, 2, parents) == 0);
+
+    CommitRangeOptions opts;
+    opts.topological = true;
+    REQUIRE(summaries(repo.commits(opts)).size() == 4);
+
+    opts.first_parent_only = true;
+    REQUIRE(summaries(repo.commits(opts))
+        == std::vector<std::string>{ "Merge side", "Commit 1", "Commit 0" });
+
+    auto range = repo.commits(opts);
+    REQUIRE(range.begin()->parent_count() == 2);
+}
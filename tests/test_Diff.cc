@@ -0,0 +1,193 @@
+/**
+ * \file   test_Diff.cc
+ * \date   Created on October 16, 2026
+ * \brief  Test suite for the Diff class.
+ *
+ * \copyright Copyright 2026 Deutsches Elektronen-Synchrotron (DESY), Hamburg
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation, either version 2.1 of the license, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <git2.h>
+#include <gul14/catch.h>
+#include <gul14/gul.h>
+
+#include "libgit4cpp/Diff.h"
+#include "libgit4cpp/Error.h"
+#include "libgit4cpp/Repository.h"
+#include "test_main.h"
+
+using namespace git;
+
+namespace {
+
+const auto reporoot = unit_test_folder() / "Diff";
+
+/// Create a repository with two commits: "file.txt" is modified and "new.txt" added.
+void create_repo()
+{
+    std::filesystem::remove_all(reporoot);
+    std::filesystem::create_directories(reporoot / "dir");
+    std::ofstream{ reporoot / "file.txt" } << "Line 1\nLine 2\nLine 3\n";
+    std::ofstream{ reporoot / "dir" / "other.txt" } << "Other\n";
+
+    auto repo = Repository::create(reporoot, InitOptions{ false, true });
+
+    std::ofstream{ reporoot / "file.txt" } << "Line 1\nChanged\nLine 3\nLine 4\n";
+    std::ofstream{ reporoot / "new.txt" } << "New\n";
+    repo.add();
+    repo.commit("Second commit");
+}
+
+} // anonymous namespace
+
+TEST_CASE("Diff: Between commits", "[Diff]")
+{
+    create_repo();
+    Repository repo{ reporoot };
+
+    auto diff = repo.diff("HEAD~1", "HEAD");
+    REQUIRE(diff.size() == 2);
+    REQUIRE(diff.empty() == false);
+
+    const auto deltas = diff.deltas();
+    REQUIRE(deltas[0].new_path == "file.txt");
+    REQUIRE(deltas[0].change == Change::modified);
+    REQUIRE(deltas[1].new_path == "new.txt");
+    REQUIRE(deltas[1].change == Change::new_file);
+    REQUIRE(diff.delta(1).new_path == "new.txt");
+    REQUIRE_THROWS_AS(diff.delta(2), git::Error);
+
+    const auto stats = diff.stats();
+    REQUIRE(stats.files_changed == 2);
+    REQUIRE(stats.insertions == 3);
+    REQUIRE(stats.deletions == 1);
+
+    REQUIRE(repo.diff("HEAD", "HEAD").empty());
+    REQUIRE(repo.diff("", "HEAD").size() == 3);
+    REQUIRE_THROWS_AS(repo.diff("HEAD", "does_not_exist"), git::Error);
+}
+
+TEST_CASE("Diff: Pathspec and options", "[Diff]")
+{
+    create_repo();
+    Repository repo{ reporoot };
+
+    DiffOptions options;
+    options.pathspec = { "new.txt" };
+    options.skip_binary_check = true;
+    auto diff = repo.diff("HEAD~1", "HEAD", options);
+    REQUIRE(diff.size() == 1);
+    REQUIRE(diff.delta(0).new_path == "new.txt");
+
+    options.pathspec = { "dir" };
+    REQUIRE(repo.diff("", "HEAD", options).size() == 1);
+}
+
+TEST_CASE("Diff: for_each()", "[Diff]")
+{
+    create_repo();
+    Repository repo{ reporoot };
+    auto diff = repo.diff("HEAD~1", "HEAD");
+
+    SECTION("Files only")
+    {
+        std::vector<std::string> files;
+        REQUIRE(diff.for_each([&files](const DiffDelta& delta)
+            {
+                files.emplace_back(delta.new_path);
+                return true;
+            }));
+        REQUIRE(files == std::vector<std::string>{ "file.txt", "new.txt" });
+    }
+
+    SECTION("Hunks and lines")
+    {
+        int hunks = 0;
+        std::string added;
+        std::string removed;
+
+        diff.for_each(nullptr,
+            [&hunks](const DiffDelta&, const DiffHunk& hunk)
+            {
+                ++hunks;
+                REQUIRE(gul14::starts_with(hunk.header, "@@"));
+                return true;
+            },
+            [&](const DiffDelta& delta, const DiffHunk&, const DiffLine& line)
+            {
+                if (delta.new_path != "file.txt")
+                    return true;
+                if (line.origin == '+')
+                    added += line.content;
+                else if (line.origin == '-')
+                    removed += line.content;
+                return true;
+            });
+
+        REQUIRE(hunks == 2);
+        REQUIRE(added == "Changed\nLine 4\n");
+        REQUIRE(removed == "Line 2\n");
+    }
+
+    SECTION("Stop early")
+    {
+        int count = 0;
+        REQUIRE(diff.for_each([&count](const DiffDelta&) { return ++count < 1; })
+            == false);
+        REQUIRE(count == 1);
+    }
+
+    SECTION("Exceptions are propagated")
+    {
+        REQUIRE_THROWS_AS(diff.for_each(
+            [](const DiffDelta&) -> bool { throw std::runtime_error{ "Test" }; }),
+            std::runtime_error);
+    }
+}
+
+TEST_CASE("Diff: Index and working directory", "[Diff]")
+{
+    create_repo();
+    Repository repo{ reporoot };
+
+    REQUIRE(repo.diff_index_to_workdir().empty());
+    REQUIRE(repo.diff_head_to_index().empty());
+
+    std::ofstream{ reporoot / "file.txt" } << "Modified\n";
+    std::ofstream{ reporoot / "untracked.txt" } << "Untracked\n";
+
+    auto unstaged = repo.diff_index_to_workdir();
+    REQUIRE(unstaged.size() == 1);
+    REQUIRE(unstaged.delta(0).new_path == "file.txt");
+
+    DiffOptions options;
+    options.include_untracked = true;
+    REQUIRE(repo.diff_index_to_workdir(options).size() == 2);
+
+    repo.add_files({ "file.txt" });
+    REQUIRE(repo.diff_index_to_workdir().empty());
+
+    auto staged = repo.diff_head_to_index();
+    REQUIRE(staged.size() == 1);
+    REQUIRE(staged.delta(0).change == Change::modified);
+}
@@ -0,0 +1,113 @@
+/**
+ * \file   test_IndexTransaction.cc
+ * \date   Created on October 16, 2026
+ * \brief  Test suite for the IndexTransaction class.
+ *
+ * \copyright Copyright 2026 Deutsches Elektronen-Synchrotron (DESY), Hamburg
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation, either version 2.1 of the license, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+
+#include <gul14/catch.h>
+#include <gul14/gul.h>
+
+#include "libgit4cpp/Error.h"
+#include "libgit4cpp/IndexTransaction.h"
+#include "libgit4cpp/Repository.h"
+#include "test_main.h"
+
+using namespace git;
+
+namespace {
+
+const auto reporoot = unit_test_folder() / "IndexTransaction";
+
+long count_staged(const RepoState& state)
+{
+    return std::count_if(state.begin(), state.end(),
+        [](const FileStatus& s) { return s.handling == "staged"; });
+}
+
+} // anonymous namespace
+
+TEST_CASE("IndexTransaction: write() and rollback", "[IndexTransaction]")
+{
+    std::filesystem::remove_all(reporoot);
+    std::filesystem::create_directories(reporoot / "dir");
+    for (int i = 0; i != 4; ++i)
+        std::ofstream{ reporoot / "dir" / gul14::cat("file", i, ".txt") } << i;
+
+    Repository repo{ reporoot };
+
+    SECTION("write() stores all modifications at once")
+    {
+        IndexTransaction transaction{ repo };
+        REQUIRE(transaction.is_active());
+        REQUIRE(repo.is_index_write_deferred());
+
+        transaction.add("dir/file0.txt");
+        auto errors = transaction.add_files({ "dir/file1.txt", "dir/file2.txt" });
+        REQUIRE(errors.empty());
+
+        REQUIRE(count_staged(repo.status()) == 3);
+        REQUIRE(count_staged(Repository{ reporoot }.status()) == 0);
+
+        transaction.write();
+        REQUIRE(transaction.is_active() == false);
+        REQUIRE(repo.is_index_write_deferred() == false);
+        REQUIRE(count_staged(Repository{ reporoot }.status()) == 3);
+
+        REQUIRE_THROWS_AS(transaction.add(), git::Error);
+    }
+
+    SECTION("Destruction without write() discards the modifications")
+    {
+        {
+            IndexTransaction transaction{ repo };
+            transaction.add();
+            REQUIRE(count_staged(repo.status()) == 4);
+        }
+        REQUIRE(count_staged(repo.status()) == 0);
+        REQUIRE(count_staged(Repository{ reporoot }.status()) == 0);
+    }
+
+    SECTION("An exception rolls back the transaction")
+    {
+        try
+        {
+            IndexTransaction transaction{ repo };
+            transaction.add();
+            throw std::runtime_error("Abort");
+        }
+        catch (const std::runtime_error&)
+        {
+        }
+        REQUIRE(count_staged(repo.status()) == 0);
+    }
+
+    SECTION("Only one transaction at a time")
+    {
+        IndexTransaction transaction{ repo };
+        REQUIRE_THROWS_AS(IndexTransaction{ repo }, git::Error);
+        transaction.rollback();
+        REQUIRE_NOTHROW(IndexTransaction{ repo });
+    }
+}
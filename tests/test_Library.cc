@@ -0,0 +1,85 @@
+/**
+ * \file   test_Library.cc
+ * \date   Created on October 16, 2026
+ * \brief  Test suite for the Library class and the global options.
+ *
+ * \copyright Copyright 2026 Deutsches Elektronen-Synchrotron (DESY), Hamburg
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation, either version 2.1 of the license, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <git2.h>
+#include <gul14/catch.h>
+
+#include "libgit4cpp/Library.h"
+#include "libgit4cpp/Repository.h"
+#include "test_main.h"
+
+using namespace git;
+
+TEST_CASE("Library: libgit2 stays initialized", "[Library]")
+{
+    const auto path = unit_test_folder() / "Library";
+
+    for (int i = 0; i != 3; ++i)
+    {
+        Repository repo{ path };
+        REQUIRE(repo.get_last_commit_message() == "Initial commit");
+    }
+
+    // git_libgit2_init() returns the new reference count: 1 would mean that libgit2 has
+    // been shut down when the last Repository was destroyed.
+    REQUIRE(git_libgit2_init() > 1);
+    git_libgit2_shutdown();
+}
+
+TEST_CASE("Library: set_global_options(), get_global_options()", "[Library]")
+{
+    const GlobalOptions old_options = get_global_options();
+    REQUIRE(old_options.cache_max_size.has_value());
+    REQUIRE(old_options.cached_memory.has_value());
+    REQUIRE(old_options.mwindow_size.has_value());
+    REQUIRE(old_options.mwindow_mapped_limit.has_value());
+    REQUIRE(old_options.strict_hash_verification.has_value() == false);
+
+    GlobalOptions options;
+    options.mwindow_size = 4 * 1024 * 1024;
+    options.mwindow_mapped_limit = 64 * 1024 * 1024;
+    options.cache_max_size = 16 * 1024 * 1024;
+    options.cache_object_limits[GIT_OBJECT_BLOB] = 1024;
+    options.strict_object_creation = false;
+    options.strict_hash_verification = false;
+    set_global_options(options);
+
+    auto new_options = get_global_options();
+    REQUIRE(new_options.mwindow_size == 4 * 1024 * 1024);
+    REQUIRE(new_options.mwindow_mapped_limit == 64 * 1024 * 1024);
+    REQUIRE(new_options.cache_max_size == 16 * 1024 * 1024);
+
+    // Unset options are left alone
+    set_global_options(GlobalOptions{ });
+    new_options = get_global_options();
+    REQUIRE(new_options.mwindow_size == 4 * 1024 * 1024);
+
+    // Restore the libgit2 defaults
+    options = old_options;
+    options.cached_memory.reset();
+    options.cache_object_limits[GIT_OBJECT_BLOB] = 0;
+    options.strict_object_creation = true;
+    options.strict_hash_verification = true;
+    set_global_options(options);
+    REQUIRE(get_global_options().mwindow_size == old_options.mwindow_size);
+}
@@ -0,0 +1,129 @@
+/**
+ * \file   test_ObjectCache.cc
+ * \date   Created on October 16, 2026
+ * \brief  Test suite for the ObjectCache class.
+ *
+ * \copyright Copyright 2026 Deutsches Elektronen-Synchrotron (DESY), Hamburg
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation, either version 2.1 of the license, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <filesystem>
+#include <fstream>
+
+#include <git2.h>
+#include <gul14/catch.h>
+
+#include "libgit4cpp/Error.h"
+#include "libgit4cpp/ObjectCache.h"
+#include "libgit4cpp/Repository.h"
+#include "test_main.h"
+
+using namespace git;
+
+namespace {
+
+const auto reporoot = unit_test_folder() / "ObjectCache";
+
+git_oid resolve(Repository& repo, const char* ref)
+{
+    git_oid id;
+    REQUIRE(git_reference_name_to_id(&id, repo.get_repo(), ref) == 0);
+    return id;
+}
+
+} // anonymous namespace
+
+TEST_CASE("ObjectCache: Hits, misses and eviction", "[ObjectCache]")
+{
+    std::filesystem::remove_all(reporoot);
+    std::filesystem::create_directories(reporoot);
+    std::ofstream{ reporoot / "file.txt" } << "Content";
+
+    Repository repo{ reporoot };
+    repo.commit("Second commit");
+    const git_oid head = resolve(repo, "HEAD");
+
+    ObjectCache cache;
+    REQUIRE(cache.byte_budget() == ObjectCache::default_byte_budget);
+    REQUIRE(cache.stats().entries == 0);
+
+    auto commit = cache.get(repo.get_repo(), head, GIT_OBJECT_COMMIT);
+    REQUIRE(commit != nullptr);
+    REQUIRE(git_oid_equal(git_object_id(commit.get()), &head));
+    REQUIRE(cache.stats().misses == 1);
+    REQUIRE(cache.stats().hits == 0);
+    REQUIRE(cache.stats().entries == 1);
+    REQUIRE(cache.stats().bytes > 0);
+
+    auto again = cache.get(repo.get_repo(), head, GIT_OBJECT_COMMIT);
+    REQUIRE(again.get() == commit.get()); // the same decoded object
+    REQUIRE(cache.stats().hits == 1);
+
+    const git_oid tree_id = *git_commit_tree_id(reinterpret_cast<git_commit*>(commit.get()));
+    auto tree = cache.get(repo.get_repo(), tree_id, GIT_OBJECT_TREE);
+    REQUIRE(cache.stats().entries == 2);
+
+    REQUIRE_THROWS_AS(cache.get(repo.get_repo(), tree_id, GIT_OBJECT_COMMIT), git::Error);
+
+    // Objects handed out stay valid when they are evicted
+    cache.set_byte_budget(0);
+    REQUIRE(cache.stats().entries == 0);
+    REQUIRE(cache.stats().bytes == 0);
+    REQUIRE(cache.stats().evictions == 2);
+    REQUIRE(git_oid_equal(git_object_id(tree.get()), &tree_id));
+
+    // Nothing is cached with a budget of zero
+    cache.get(repo.get_repo(), head, GIT_OBJECT_COMMIT);
+    REQUIRE(cache.stats().entries == 0);
+
+    cache.reset_stats();
+    REQUIRE(cache.stats().hits == 0);
+    REQUIRE(cache.stats().misses == 0);
+    REQUIRE(cache.stats().evictions == 0);
+}
+
+TEST_CASE("ObjectCache: Used by Repository", "[ObjectCache]")
+{
+    std::filesystem::remove_all(reporoot);
+    Repository repo{ reporoot };
+
+    repo.object_cache().reset_stats();
+    REQUIRE(repo.get_last_commit_message() == "Initial commit");
+    REQUIRE(repo.get_last_commit_message() == "Initial commit");
+    REQUIRE(repo.object_cache().stats().hits >= 1);
+
+    repo.reset_repo();
+    REQUIRE(repo.object_cache().stats().entries == 0);
+    REQUIRE(repo.get_last_commit_message() == "Initial commit");
+}
+
+TEST_CASE("ObjectCache: Repository is destroyed with a populated cache", "[ObjectCache]")
+{
+    std::filesystem::remove_all(reporoot);
+
+    // Meant to be run with -Db_sanitize=address: the cached commit and tree must be
+    // freed before the git_repository they belong to.
+    {
+        Repository repo{ reporoot };
+        repo.object_cache().reset_stats();
+        REQUIRE(repo.get_last_commit_message() == "Initial commit");
+        REQUIRE(repo.object_cache().stats().entries >= 1);
+    }
+
+    auto repo = Repository::open(reporoot);
+    REQUIRE(repo.get_last_commit_message() == "Initial commit");
+}
@@ -0,0 +1,95 @@
+/**
+ * \file   test_Oid.cc
+ * \date   Created on October 16, 2026
+ * \brief  Test suite for the Oid class.
+ *
+ * \copyright Copyright 2026 Deutsches Elektronen-Synchrotron (DESY), Hamburg
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation, either version 2.1 of the license, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <filesystem>
+#include <sstream>
+#include <unordered_set>
+
+#include <git2.h>
+#include <gul14/catch.h>
+
+#include "libgit4cpp/Error.h"
+#include "libgit4cpp/Oid.h"
+#include "libgit4cpp/Repository.h"
+#include "libgit4cpp/TreeBuilder.h"
+#include "test_main.h"
+
+using namespace git;
+
+TEST_CASE("Oid: Construction, comparison and formatting", "[Oid]")
+{
+    const Oid zero;
+    REQUIRE(zero.is_zero());
+    REQUIRE(zero.to_string() == std::string(2 * Oid::size(), '0'));
+
+    const auto hex = "4a8f2c1d00000000000000000000000000000abc";
+    const Oid a = Oid::from_string(hex);
+    REQUIRE(a.is_zero() == false);
+    REQUIRE(a.to_string() == hex);
+    REQUIRE(a.to_short_string() == "4a8f2c1");
+    REQUIRE(a.to_short_string(100) == hex);
+
+    std::ostringstream stream;
+    stream << a;
+    REQUIRE(stream.str() == hex);
+
+    const Oid b = Oid::from_string("4a8f2c1d00000000000000000000000000000abd");
+    REQUIRE(a != b);
+    REQUIRE(a < b);
+    REQUIRE(b > a);
+    REQUIRE(a <= a);
+    REQUIRE(a == Oid{ a.get() });
+    REQUIRE(git_oid_equal(&a.get(), &Oid::from_string(hex).get()));
+
+    std::unordered_set<Oid> set{ a, b, a };
+    REQUIRE(set.size() == 2);
+
+    REQUIRE_THROWS_AS(Oid::from_string("4a8f"), git::Error);
+    REQUIRE_THROWS_AS(Oid::from_string("xyz02c1d00000000000000000000000000000abc"), git::Error);
+}
+
+TEST_CASE("Oid: Repository::head_oid(), resolve()", "[Oid]")
+{
+    const auto reporoot = unit_test_folder() / "Oid";
+    std::filesystem::remove_all(reporoot);
+    auto repo = Repository::create(reporoot, InitOptions{ true });
+
+    REQUIRE(repo.head_oid().is_zero());
+    REQUIRE_THROWS_AS(repo.resolve("refs/heads/main"), git::Error);
+
+    TreeBuilder builder{ repo };
+    builder.insert("file.txt", "Content");
+    const Oid commit_id = builder.commit("HEAD", "First commit");
+
+    REQUIRE(repo.head_oid() == commit_id);
+    REQUIRE(repo.resolve("HEAD") == commit_id);
+    REQUIRE(repo.resolve("refs/heads/main") == commit_id);
+    REQUIRE_THROWS_AS(repo.resolve("refs/heads/does_not_exist"), git::Error);
+
+    // The same ID is seen by another Repository object after an external change
+    auto other = Repository::open(reporoot);
+    REQUIRE(other.head_oid() == commit_id);
+    builder.insert("file.txt", "Changed");
+    const Oid second_id = builder.commit("HEAD", "Second commit");
+    REQUIRE(other.head_oid() == second_id);
+}
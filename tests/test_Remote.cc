@@ -22,6 +22,7 @@
 
 // SPDX-License-Identifier: LGPL-2.1-or-later
 
+#include <algorithm>
 #include <filesystem>
 #include <fstream>
 
@@ -42,6 +43,14 @@ using gul14::cat;
 static const auto working_dir = unit_test_folder() / "Remote_list_references";
 static const auto remote_repo = unit_test_folder() / "Remote_list_references.remote";
 
+/// Return an iterator to the head with the given name or refs.end().
+static std::vector<RemoteHead>::const_iterator
+find_head(const std::vector<RemoteHead>& refs, const std::string& name)
+{
+    return std::find_if(refs.begin(), refs.end(),
+        [&name](const RemoteHead& head) { return head.name == name; });
+}
+
 TEST_CASE("Remote: Constructor", "[Remote]")
 {
     const auto reporoot = unit_test_folder() / "Remote";
@@ -93,16 +102,130 @@ TEST_CASE("Remote: list_references()", "[Remote]")
 
     // The remote must now contain the main branch "refs/heads/main". Additionally, it
     // probably contains a reference for "HEAD".
+    const auto head_id = repo->head_oid();
     refs = remote.list_references();
     REQUIRE(refs.size() >= 1);
-    REQUIRE(std::find(refs.begin(), refs.end(), "refs/heads/main"s) != refs.end());
+    auto main_head = find_head(refs, "refs/heads/main");
+    REQUIRE(main_head != refs.end());
+    REQUIRE(main_head->oid == head_id);
+    REQUIRE(main_head->symref_target.empty());
+
+    auto head = find_head(refs, "HEAD");
+    if (head != refs.end())
+        REQUIRE(head->oid == head_id);
 
-    // Remove the "parent" repository and check if the remote still works
+    // list_references() does not leave a connection open
+    REQUIRE(not remote.is_connected());
+
+    // Remove the "parent" repository and check if an open connection still works
+    auto connection = remote.connect();
     repo.reset();
     refs = remote.list_references();
     REQUIRE(refs.size() >= 1);
-    REQUIRE(std::find(refs.begin(), refs.end(), "refs/heads/main"s) != refs.end());
+    REQUIRE(find_head(refs, "refs/heads/main") != refs.end());
+}
+
+TEST_CASE("Remote: connect(), disconnect()", "[Remote]")
+{
+    // Use the repo-with-a-remote from the previous test
+    auto repo = Repository::open(working_dir);
+    auto remote = repo.get_remote("origin");
+    REQUIRE(remote.has_value());
+    REQUIRE(not remote->is_connected());
+
+    {
+        auto connection = remote->connect();
+        REQUIRE(connection.is_open());
+        REQUIRE(remote->is_connected());
+
+        // Several operations share the connection
+        auto refs = remote->list_references();
+        REQUIRE(find_head(refs, "refs/heads/main") != refs.end());
+        repo.fetch(*remote);
+        REQUIRE(remote->is_connected());
+        REQUIRE(repo.resolve("refs/remotes/origin/main") == repo.head_oid());
+        refs = remote->list_references();
+        REQUIRE(find_head(refs, "refs/heads/main") != refs.end());
+
+        // Moving transfers the ownership of the connection
+        auto other = std::move(connection);
+        REQUIRE(not connection.is_open());
+        REQUIRE(other.is_open());
+        REQUIRE(remote->is_connected());
+    }
+
+    // The connection is closed at the end of the scope
+    REQUIRE(not remote->is_connected());
+
+    auto connection = remote->connect(Direction::push);
+    REQUIRE(remote->is_connected());
+    connection.close();
+    REQUIRE(not connection.is_open());
+    REQUIRE(not remote->is_connected());
 
+    connection = remote->connect();
+    remote->disconnect();
+    REQUIRE(not connection.is_open());
+
+    // A stale connection object must not close a newer connection
+    auto newer = remote->connect();
+    REQUIRE(not connection.is_open());
+    connection.close();
+    REQUIRE(newer.is_open());
+    REQUIRE(remote->is_connected());
+
+    auto newest = remote->connect();
+    REQUIRE(not newer.is_open());
+    newer = RemoteConnection{ std::move(newest) };
+    REQUIRE(newer.is_open());
+    REQUIRE(remote->is_connected());
+}
+
+TEST_CASE("Remote: A connection carries only a single matching transfer", "[Remote]")
+{
+    // Use the repo-with-a-remote from the previous tests
+    auto repo = Repository::open(working_dir);
+    auto remote = repo.get_remote("origin");
+    REQUIRE(remote.has_value());
+
+    SECTION("A second fetch connects anew")
+    {
+        auto connection = remote->connect(Direction::fetch);
+        repo.fetch(*remote);
+        REQUIRE(connection.is_open());
+
+        repo.fetch(*remote);
+        REQUIRE(not connection.is_open());
+        REQUIRE(not remote->is_connected());
+    }
+
+    SECTION("A push does not use a fetch connection")
+    {
+        auto connection = remote->connect(Direction::fetch);
+        repo.push(*remote);
+        REQUIRE(not connection.is_open());
+        REQUIRE(not remote->is_connected());
+    }
+
+    SECTION("A push uses a push connection")
+    {
+        auto connection = remote->connect(Direction::push);
+        const auto refs = remote->list_references();
+        REQUIRE(find_head(refs, "refs/heads/main") != refs.end());
+        repo.push(*remote);
+        REQUIRE(connection.is_open());
+
+        repo.fetch(*remote);
+        REQUIRE(not connection.is_open());
+    }
+
+    SECTION("Connections do not outlive their Remote")
+    {
+        auto connection = remote->connect();
+        remote.reset();
+        REQUIRE(not connection.is_open());
+        connection.close();
+    }
 }
 
 TEST_CASE("wrapper_functions: branch_remote_name()", "[Remote]")
@@ -22,9 +22,11 @@
 
 // SPDX-License-Identifier: LGPL-2.1-or-later
 
+#include <algorithm>
 #include <filesystem>
 #include <fstream>
 #include <iostream>
+#include <stdexcept>
 
 #include <git2.h>
 #include <gul14/catch.h>
@@ -32,6 +34,7 @@
 
 #include "libgit4cpp/Error.h"
 #include "libgit4cpp/Repository.h"
+#include "libgit4cpp/TreeBuilder.h"
 #include "libgit4cpp/wrapper_functions.h"
 #include "test_main.h"
 
@@ -581,6 +584,495 @@ TEST_CASE("Repository add() with glob", "[Repository]")
     }
 }
 
+TEST_CASE("Repository: status() with StatusOptions", "[Repository]")
+{
+    std::filesystem::remove_all(reporoot);
+    create_testfiles("status_options", 3, "Original");
+
+    Repository repo{ reporoot };
+    repo.add();
+    repo.commit("Add files");
+
+    // Modify file0.txt
+    create_testfiles("status_options", 1, "Changed");
+
+    // The default options list all files
+    REQUIRE(repo.status().size() == 3);
+    REQUIRE(repo.status(StatusOptions{ }).size() == 3);
+
+    // Only changed files
+    StatusOptions opts;
+    opts.include_unmodified = false;
+    opts.include_ignored = false;
+
+    auto stats = repo.status(opts);
+    REQUIRE(stats.size() == 1);
+    REQUIRE(stats[0].path_name == "status_options/file0.txt");
+    REQUIRE(stats[0].handling == "unstaged");
+    REQUIRE(stats[0].changes == "modified");
+
+    // Restrict the status to a single file
+    StatusOptions path_opts;
+    path_opts.pathspec = { "status_options/file2.txt" };
+    path_opts.pathspec_literal = true;
+
+    stats = repo.status(path_opts);
+    REQUIRE(stats.size() == 1);
+    REQUIRE(stats[0].path_name == "status_options/file2.txt");
+    REQUIRE(stats[0].handling == "unchanged");
+
+    // Nothing left to commit
+    repo.add();
+    repo.commit("Change file0.txt");
+    REQUIRE(repo.status(opts).empty());
+}
+
+TEST_CASE("Repository: compact_status()", "[Repository]")
+{
+    std::filesystem::remove_all(reporoot);
+    create_testfiles("compact_status", 2, "Original");
+
+    Repository repo{ reporoot };
+    repo.add("compact_status/file0.txt");
+
+    auto stats = repo.compact_status();
+    REQUIRE(stats.size() == 2);
+    REQUIRE(stats[0].path_name == "compact_status/file0.txt");
+    REQUIRE(stats[0].handling == Handling::staged);
+    REQUIRE(stats[0].changes == Change::new_file);
+    REQUIRE(stats[1].path_name == "compact_status/file1.txt");
+    REQUIRE(stats[1].handling == Handling::untracked);
+    REQUIRE(stats[1].changes == Change::untracked);
+
+    // The string adapter must produce the same result as status()
+    std::stringstream ss_compact{ };
+    ss_compact << to_repo_state(stats);
+    std::stringstream ss{ };
+    ss << repo.status();
+    REQUIRE(ss_compact.str() == ss.str());
+    REQUIRE(gul14::trim(ss.str()) == "RepoState {\n" \
+        "FileStatus{ \"compact_status/file0.txt\": staged; new file }\n" \
+        "FileStatus{ \"compact_status/file1.txt\": untracked; untracked }\n" \
+        "}");
+
+    REQUIRE(to_string(Handling::unstaged) == "unstaged");
+    REQUIRE(to_string(Change::typechange) == "typechange");
+}
+
+TEST_CASE("Repository: deferred index writing", "[Repository]")
+{
+    std::filesystem::remove_all(reporoot);
+    create_testfiles("deferred", 3, "Deferred");
+
+    Repository repo{ reporoot };
+    REQUIRE(repo.is_index_write_deferred() == false);
+
+    repo.set_deferred_index_write(true);
+    REQUIRE(repo.is_index_write_deferred() == true);
+
+    repo.add_files({ "deferred/file0.txt", "deferred/file1.txt" });
+    repo.add("deferred/file2.txt");
+
+    auto count_staged = [](const RepoState& state) {
+        return std::count_if(state.begin(), state.end(),
+            [](const FileStatus& s) { return s.handling == "staged"; });
+    };
+
+    // The modifications are visible in this object, but not yet on disk
+    REQUIRE(count_staged(repo.status()) == 3);
+    REQUIRE(count_staged(Repository{ reporoot }.status()) == 0);
+
+    repo.write_index();
+    REQUIRE(count_staged(Repository{ reporoot }.status()) == 3);
+
+    // Unwritten modifications are discarded by reset()
+    repo.remove_files({ "deferred/file0.txt" });
+    repo.reset(0);
+    REQUIRE(count_staged(repo.status()) == 0);
+
+    // commit() writes pending modifications
+    repo.add();
+    repo.commit("Deferred commit");
+    REQUIRE(repo.get_last_commit_message() == "Deferred commit");
+    REQUIRE(count_staged(Repository{ reporoot }.status()) == 0);
+    REQUIRE(count_staged(repo.status()) == 0);
+
+    // Switching the deferred mode off writes pending modifications
+    create_testfiles("deferred", 1, "Changed");
+    repo.add();
+    repo.set_deferred_index_write(false);
+    REQUIRE(count_staged(Repository{ reporoot }.status()) == 1);
+}
+
+TEST_CASE("Repository: stage_buffer()", "[Repository]")
+{
+    std::filesystem::remove_all(reporoot);
+
+    Repository repo{ reporoot };
+    repo.stage_buffer("generated/sequence.txt", "Generated content\n");
+    repo.stage_buffer("generated/run.sh", "#!/bin/sh\n", GIT_FILEMODE_BLOB_EXECUTABLE);
+    repo.commit("Add generated files");
+
+    // The working directory is untouched
+    REQUIRE(std::filesystem::exists(reporoot / "generated") == false);
+
+    git_object* obj = nullptr;
+    REQUIRE(git_revparse_single(&obj, repo.get_repo(), "HEAD:generated/sequence.txt") == 0);
+    auto obj_cleanup = gul14::finally([obj]() { git_object_free(obj); });
+    REQUIRE(git_object_type(obj) == GIT_OBJECT_BLOB);
+
+    const auto* blob = reinterpret_cast<const git_blob*>(obj);
+    std::string content(static_cast<const char*>(git_blob_rawcontent(blob)),
+        static_cast<std::size_t>(git_blob_rawsize(blob)));
+    REQUIRE(content == "Generated content\n");
+
+    // The files are missing from the working directory
+    StatusOptions opts;
+    opts.include_unmodified = false;
+    auto stats = repo.compact_status(opts);
+    REQUIRE(stats.size() == 2);
+    for (const auto& elm : stats)
+    {
+        REQUIRE(elm.handling == Handling::unstaged);
+        REQUIRE(elm.changes == Change::deleted);
+    }
+}
+
+TEST_CASE("Repository: OpenMode", "[Repository]")
+{
+    const auto bare_path = unit_test_folder() / "bare_repo.git";
+    const auto missing_path = unit_test_folder() / "missing_repo";
+    std::filesystem::remove_all(bare_path);
+    std::filesystem::remove_all(missing_path);
+
+    SECTION("open_only does not create a repository")
+    {
+        REQUIRE_THROWS_AS(Repository(missing_path, OpenMode::open_only), git::Error);
+        REQUIRE(std::filesystem::exists(missing_path) == false);
+    }
+
+    SECTION("init_bare creates a bare repository without commits")
+    {
+        Repository repo{ bare_path, OpenMode::init_bare };
+        REQUIRE(repo.is_bare());
+        REQUIRE(std::filesystem::exists(bare_path / "HEAD"));
+        REQUIRE_THROWS_AS(repo.get_last_commit_message(), git::Error);
+        REQUIRE_THROWS_AS(repo.status(), git::Error);
+
+        // Commit without index and working directory
+        TreeBuilder builder{ repo };
+        builder.insert("sequence/step.txt", "Step");
+        builder.commit("HEAD", "First commit");
+        REQUIRE(repo.get_last_commit_message() == "First commit");
+        REQUIRE(repo.get_current_branch_name() == "main");
+
+        // Reopen the existing repository
+        Repository reopened{ bare_path, OpenMode::open_only };
+        REQUIRE(reopened.is_bare());
+        REQUIRE(reopened.get_last_commit_message() == "First commit");
+    }
+
+    SECTION("init_with_workdir is the default")
+    {
+        Repository repo{ missing_path };
+        REQUIRE(repo.is_bare() == false);
+        REQUIRE(repo.get_last_commit_message() == "Initial commit");
+    }
+}
+
+TEST_CASE("Repository: open(), create()", "[Repository]")
+{
+    const auto path = unit_test_folder() / "created_repo";
+    std::filesystem::remove_all(path);
+
+    REQUIRE_THROWS_AS(Repository::open(path), git::Error);
+    REQUIRE(std::filesystem::exists(path) == false);
+
+    SECTION("Empty repository")
+    {
+        auto repo = Repository::create(path);
+        REQUIRE(repo.is_bare() == false);
+        REQUIRE_THROWS_AS(repo.get_last_commit_message(), git::Error);
+
+        // Files in the directory are not committed automatically
+        std::ofstream{ path / "file.txt" } << "Content";
+        auto state = repo.compact_status();
+        REQUIRE(state.size() == 1);
+        REQUIRE(state[0].handling == Handling::untracked);
+
+        REQUIRE_THROWS_AS(Repository::create(path), git::Error);
+
+        auto reopened = Repository::open(path);
+        REQUIRE(reopened.compact_status() == state);
+    }
+
+    SECTION("Initial commit and custom HEAD")
+    {
+        std::filesystem::create_directories(path / "sub");
+        std::ofstream{ path / "sub" / "file.txt" } << "Content";
+
+        InitOptions options;
+        options.initial_commit = true;
+        options.initial_head = "develop";
+
+        auto repo = Repository::create(path, options);
+        REQUIRE(repo.get_last_commit_message() == "Initial commit");
+        REQUIRE(repo.get_current_branch_name() == "develop");
+        REQUIRE(repo.read_blob("HEAD", "sub/file.txt").content() == "Content");
+
+        StatusOptions options_changed;
+        options_changed.include_unmodified = false;
+        REQUIRE(repo.compact_status(options_changed).empty());
+    }
+
+    SECTION("Bare repository")
+    {
+        InitOptions options;
+        options.bare = true;
+        auto repo = Repository::create(path, options);
+        REQUIRE(repo.is_bare());
+        REQUIRE(Repository::open(path).is_bare());
+    }
+}
+
+TEST_CASE("Repository: log()", "[Repository]")
+{
+    const auto path = unit_test_folder() / "log_repo";
+    std::filesystem::remove_all(path);
+    auto repo = Repository::create(path, InitOptions{ true });
+
+    REQUIRE(repo.log("seq_a").empty());
+
+    auto write = [&repo](const std::string& base, const std::string& file,
+        const std::string& content, const std::string& msg)
+        {
+            TreeBuilder builder{ repo, base };
+            if (content.empty())
+                builder.remove(file);
+            else
+                builder.insert(file, content);
+            builder.commit("HEAD", msg);
+        };
+
+    write("", "seq_a/step.lua", "1", "Add A");
+    write("HEAD", "seq_b/step.lua", "1", "Add B");
+    write("HEAD", "seq_a/step.lua", "2", "Change A");
+    write("HEAD", "seq_b/step.lua", "2", "Change B");
+    write("HEAD", "seq_a/step.lua", "", "Remove A");
+
+    auto summaries = [](const std::vector<CommitInfo>& commits)
+        {
+            std::vector<std::string> result;
+            for (const auto& c : commits)
+                result.push_back(c.summary);
+            return result;
+        };
+
+    REQUIRE(summaries(repo.log("seq_a"))
+        == std::vector<std::string>{ "Remove A", "Change A", "Add A" });
+    REQUIRE(summaries(repo.log("seq_b/step.lua"))
+        == std::vector<std::string>{ "Change B", "Add B" });
+    REQUIRE(summaries(repo.log("seq_a", 2))
+        == std::vector<std::string>{ "Remove A", "Change A" });
+    REQUIRE(repo.log("does_not_exist").empty());
+    REQUIRE_THROWS_AS(repo.log(""), git::Error);
+
+    // Cached results are not reused after HEAD moves
+    write("HEAD", "seq_a/step.lua", "3", "Re-add A");
+    REQUIRE(repo.log("seq_a", 1).at(0).summary == "Re-add A");
+    REQUIRE(repo.log("seq_a").size() == 4);
+    REQUIRE(repo.log("seq_a").at(0).id.size() == GIT_OID_HEXSZ);
+}
+
+TEST_CASE("Repository: write_commit_graph(), is_descendant_of(), merge_base()",
+    "[Repository]")
+{
+    const auto path = unit_test_folder() / "commit_graph_repo";
+    std::filesystem::remove_all(path);
+    auto repo = Repository::create(path, InitOptions{ true });
+
+    for (int i = 0; i != 3; ++i)
+    {
+        TreeBuilder builder{ repo, i == 0 ? "" : "HEAD" };
+        builder.insert("file.txt", cat("Version ", i));
+        builder.commit("HEAD", cat("Commit ", i));
+    }
+
+    // Branch off a side branch from the second commit
+    auto base = revparse_single(repo.get_repo(), "HEAD~1");
+    REQUIRE(base != nullptr);
+    const git_oid base_id = *git_object_id(base.get());
+    git_reference* side_ref = nullptr;
+    REQUIRE(git_reference_create(&side_ref, repo.get_repo(), "refs/heads/side", &base_id,
+        0, "Create side branch") == 0);
+    git_reference_free(side_ref);
+
+    TreeBuilder side{ repo, "side" };
+    side.insert("side.txt", "Side");
+    side.commit("refs/heads/side", "Side commit");
+
+    // An unrelated branch without common history
+    TreeBuilder orphan{ repo };
+    orphan.insert("orphan.txt", "Orphan");
+    orphan.commit("refs/heads/orphan", "Orphan commit");
+
+    int major = 0, minor = 0, rev = 0;
+    git_libgit2_version(&major, &minor, &rev);
+    if (major > 1 || (major == 1 && minor >= 2))
+    {
+        repo.write_commit_graph();
+        REQUIRE(std::filesystem::exists(path / "objects" / "info" / "commit-graph"));
+        repo.write_commit_graph(); // refresh
+    }
+    else
+    {
+        REQUIRE_THROWS_AS(repo.write_commit_graph(), git::Error);
+    }
+
+    REQUIRE(repo.is_descendant_of("HEAD", "HEAD~2"));
+    REQUIRE(repo.is_descendant_of("HEAD~2", "HEAD") == false);
+    REQUIRE(repo.is_descendant_of("HEAD", "HEAD") == false);
+    REQUIRE_THROWS_AS(repo.is_descendant_of("HEAD", "does_not_exist"), git::Error);
+
+    REQUIRE(repo.is_descendant_of("side", "HEAD~1"));
+    REQUIRE(repo.is_descendant_of("side", "HEAD") == false);
+
+    const git_oid merge_base = repo.merge_base("HEAD", "side");
+    REQUIRE(git_oid_equal(&merge_base, &base_id));
+    REQUIRE_THROWS_AS(repo.merge_base("HEAD", "orphan"), git::Error);
+}
+
+TEST_CASE("Repository: maintenance()", "[Repository]")
+{
+    const auto path = unit_test_folder() / "maintenance_repo";
+    std::filesystem::remove_all(path);
+    std::filesystem::create_directories(path / "dir");
+    for (int i = 0; i != 5; ++i)
+        std::ofstream{ path / "dir" / cat("file", i, ".txt") } << "Content " << i;
+
+    auto count_loose_objects = [&path]()
+        {
+            namespace fs = std::filesystem;
+            std::size_t count = 0;
+            for (const auto& dir : fs::directory_iterator{ path / ".git" / "objects" })
+            {
+                if (dir.path().filename().string().size() == 2)
+                {
+                    count += std::distance(fs::directory_iterator{ dir },
+                        fs::directory_iterator{ });
+                }
+            }
+            return count;
+        };
+
+    auto repo = Repository::create(path, InitOptions{ false, true });
+    const auto num_loose = count_loose_objects();
+    REQUIRE(num_loose >= 8); // 5 blobs, 2 trees, 1 commit
+
+    MaintenanceOptions options;
+    options.prune_loose_objects = false;
+    auto stats = repo.maintenance(options);
+    REQUIRE(stats.objects_packed == num_loose);
+    REQUIRE(stats.loose_objects_removed == 0);
+    REQUIRE(stats.pack_bytes > 0);
+    REQUIRE(count_loose_objects() == num_loose);
+
+    stats = repo.maintenance();
+    REQUIRE(stats.objects_packed == num_loose);
+    REQUIRE(stats.loose_objects_removed == num_loose);
+    REQUIRE(stats.loose_bytes > 0);
+    REQUIRE(count_loose_objects() == 0);
+
+    // Everything can still be read
+    REQUIRE(repo.get_last_commit_message() == "Initial commit");
+    REQUIRE(Repository::open(path).log("dir").size() == 1);
+    StatusOptions changed_only;
+    changed_only.include_unmodified = false;
+    REQUIRE(repo.compact_status(changed_only).empty());
+
+    // Nothing left to do
+    stats = repo.maintenance();
+    REQUIRE(stats.objects_packed == 0);
+    REQUIRE(stats.bytes_saved() == 0);
+}
+
+TEST_CASE("Repository: ahead_behind()", "[Repository]")
+{
+    const auto path = unit_test_folder() / "ahead_behind_repo";
+    std::filesystem::remove_all(path);
+    auto repo = Repository::create(path, InitOptions{ true });
+
+    auto commit = [&repo](const std::string& refname, const std::string& base,
+        const std::string& message)
+        {
+            TreeBuilder builder{ repo, base };
+            builder.insert("file.txt", message);
+            builder.commit(refname, message);
+        };
+
+    commit("refs/heads/main", "", "Initial commit");
+    repo.new_branch("feature", "main");
+    commit("refs/heads/feature", "feature", "Feature 1");
+    commit("refs/heads/feature", "feature", "Feature 2");
+    commit("refs/heads/main", "main", "Main 1");
+
+    REQUIRE(repo.ahead_behind("feature", "main") == AheadBehind{ 2, 1 });
+    REQUIRE(repo.ahead_behind("main", "feature") == AheadBehind{ 1, 2 });
+    REQUIRE(repo.ahead_behind("main", "main").up_to_date());
+    REQUIRE(repo.ahead_behind("main~1", "main") == AheadBehind{ 0, 1 });
+    REQUIRE_THROWS_AS(repo.ahead_behind("main", "does_not_exist"), git::Error);
+
+    // Results follow the branches when they move
+    commit("refs/heads/feature", "feature", "Feature 3");
+    REQUIRE(repo.ahead_behind("feature", "main") == AheadBehind{ 3, 1 });
+    REQUIRE(repo.ahead_behind("feature", "main") == AheadBehind{ 3, 1 });
+}
+
+TEST_CASE("Repository: branch_up_to_date()", "[Repository]")
+{
+    const auto working_dir = unit_test_folder() / "up_to_date_test";
+    const auto remote_repo = unit_test_folder() / "up_to_date_test_remote";
+
+    std::filesystem::remove_all(working_dir);
+    std::filesystem::remove_all(remote_repo);
+
+    Repository repo{ working_dir };
+    std::ofstream f(working_dir / "test.txt");
+    f << "Version 1\n";
+    f.close();
+    repo.add();
+    repo.commit("Add test.txt");
+
+    // Without an upstream branch, the question cannot be answered
+    REQUIRE_THROWS_AS(repo.branch_up_to_date("main"), git::Error);
+    REQUIRE_THROWS_AS(repo.branch_up_to_date("does_not_exist"), git::Error);
+
+    repository_init(remote_repo, true);
+    auto remote = repo.add_remote(
+        "origin", "file://" + std::filesystem::absolute(remote_repo).string());
+    repo.push(remote);
+    repo.fetch(remote);
+
+    auto main_ref = branch_lookup(repo.get_repo(), "main", GIT_BRANCH_LOCAL);
+    REQUIRE(main_ref != nullptr);
+    REQUIRE(git_branch_set_upstream(main_ref.get(), "origin/main") == 0);
+
+    REQUIRE(repo.branch_up_to_date("main"));
+
+    f.open(working_dir / "test.txt");
+    f << "Version 2\n";
+    f.close();
+    repo.add();
+    repo.commit("Change test.txt");
+
+    REQUIRE(not repo.branch_up_to_date("main"));
+    REQUIRE(repo.ahead_behind("main", "origin/main") == AheadBehind{ 1, 0 });
+
+    repo.push(remote);
+    repo.fetch(remote);
+    REQUIRE(repo.branch_up_to_date("main"));
+}
+
 TEST_CASE("Repository: get_remote(), add_remote()", "[Repository]")
 {
     std::filesystem::remove_all(reporoot);
@@ -700,7 +1192,254 @@ TEST_CASE("Repository: push()", "[Repository]")
     // probably contains a reference for "HEAD".
     refs = remote.list_references();
     REQUIRE(refs.size() >= 1);
-    REQUIRE(std::find(refs.begin(), refs.end(), "refs/heads/main"s) != refs.end());
+    auto main_head = std::find_if(refs.begin(), refs.end(),
+        [](const RemoteHead& head) { return head.name == "refs/heads/main"; });
+    REQUIRE(main_head != refs.end());
+    REQUIRE(main_head->oid == repo.head_oid());
+}
+
+TEST_CASE("Repository: fetch()", "[Repository]")
+{
+    const auto working_dir = unit_test_folder() / "fetch_test";
+    const auto remote_repo = unit_test_folder() / "fetch_test_remote";
+    const auto mirror_repo = unit_test_folder() / "fetch_test_mirror";
+
+    std::filesystem::remove_all(working_dir);
+    std::filesystem::remove_all(remote_repo);
+    std::filesystem::remove_all(mirror_repo);
+
+    const auto remote_url = "file://" + std::filesystem::absolute(remote_repo).string();
+
+    // Create a local repository with two branches and push both to a bare remote
+    Repository repo{ working_dir };
+    std::ofstream f(working_dir / "test.txt");
+    f << "fetch() test\n";
+    f.close();
+    repo.add();
+    repo.commit("Add test.txt");
+    repo.new_branch("side");
+
+    repository_init(remote_repo, true);
+    auto origin = repo.add_remote("origin", remote_url);
+    repo.push(origin, "refs/heads/main:refs/heads/main");
+    repo.push(origin, "refs/heads/side:refs/heads/side");
+
+    // Fetch everything into an empty mirror
+    auto mirror = Repository::create(mirror_repo, InitOptions{ true });
+    auto mirror_origin = mirror.add_remote("origin", remote_url);
+
+    SECTION("Default options fetch all branches and report progress")
+    {
+        std::size_t num_calls = 0;
+        FetchOptions opts;
+        opts.progress = [&num_calls](const FetchStats& s)
+            {
+                ++num_calls;
+                REQUIRE(s.received_objects <= s.total_objects);
+                return true;
+            };
+
+        auto stats = mirror.fetch(mirror_origin, opts);
+        REQUIRE(num_calls > 0);
+        REQUIRE(stats.total_objects > 0);
+        REQUIRE(stats.indexed_objects == stats.total_objects);
+        REQUIRE(stats.bytes_per_second() >= 0.0);
+        REQUIRE(mirror.resolve("refs/remotes/origin/main") == repo.head_oid());
+        REQUIRE(mirror.resolve("refs/remotes/origin/side") == repo.head_oid());
+
+        // A second fetch has nothing left to transfer
+        stats = mirror.fetch(mirror_origin);
+        REQUIRE(stats.received_objects == 0);
+    }
+
+    SECTION("Explicit refspecs only fetch the requested refs")
+    {
+        FetchOptions opts;
+        opts.refspecs = { "+refs/heads/side:refs/heads/mirrored_side" };
+        mirror.fetch(mirror_origin, opts);
+        REQUIRE(mirror.resolve("refs/heads/mirrored_side") == repo.head_oid());
+        REQUIRE_THROWS_AS(mirror.resolve("refs/remotes/origin/main"), git::Error);
+    }
+
+    SECTION("prune removes remote-tracking branches that are gone on the remote")
+    {
+        mirror.fetch(mirror_origin);
+        repo.push(origin, ":refs/heads/side");
+
+        mirror.fetch(mirror_origin);
+        REQUIRE_NOTHROW(mirror.resolve("refs/remotes/origin/side"));
+
+        FetchOptions opts;
+        opts.prune = true;
+        mirror.fetch(mirror_origin, opts);
+        REQUIRE_THROWS_AS(mirror.resolve("refs/remotes/origin/side"), git::Error);
+        REQUIRE_NOTHROW(mirror.resolve("refs/remotes/origin/main"));
+    }
+
+    SECTION("remote.<name>.prune is honored unless prune is requested explicitly")
+    {
+        mirror.fetch(mirror_origin);
+        repo.push(origin, ":refs/heads/side");
+
+        git_config* config = nullptr;
+        REQUIRE(git_repository_config(&config, mirror.get_repo()) == 0);
+        REQUIRE(git_config_set_bool(config, "remote.origin.prune", 1) == 0);
+        git_config_free(config);
+
+        // The configuration is read when the remote is looked up
+        auto configured_origin = mirror.get_remote("origin");
+        REQUIRE(configured_origin.has_value());
+
+        SECTION("Fresh connection")
+        {
+            mirror.fetch(*configured_origin);
+        }
+
+        SECTION("Open connection")
+        {
+            auto connection = configured_origin->connect();
+            mirror.fetch(*configured_origin);
+        }
+
+        REQUIRE_THROWS_AS(mirror.resolve("refs/remotes/origin/side"), git::Error);
+        REQUIRE_NOTHROW(mirror.resolve("refs/remotes/origin/main"));
+    }
+
+    SECTION("Returning false from the progress callback cancels the fetch")
+    {
+        FetchOptions opts;
+        opts.progress = [](const FetchStats&) { return false; };
+        REQUIRE_THROWS_AS(mirror.fetch(mirror_origin, opts), git::Error);
+    }
+
+    SECTION("Exceptions from the progress callback are propagated")
+    {
+        FetchOptions opts;
+        opts.progress = [](const FetchStats&) -> bool { throw std::runtime_error{ "x" }; };
+        REQUIRE_THROWS_AS(mirror.fetch(mirror_origin, opts), std::runtime_error);
+    }
+
+    SECTION("Shallow fetches are rejected by the local transport")
+    {
+        // libgit2 < 1.7 cannot fetch shallow at all, newer versions support it only over
+        // smart transports (https, ssh, git). The tests have no such server, so only the
+        // error path can be verified here: no full fetch may happen silently.
+        FetchOptions opts;
+        opts.depth = 1;
+        REQUIRE_THROWS_AS(mirror.fetch(mirror_origin, opts), git::Error);
+        REQUIRE_THROWS_AS(mirror.resolve("refs/remotes/origin/main"), git::Error);
+    }
+}
+
+TEST_CASE("Repository: clone()", "[Repository]")
+{
+    const auto source_dir = unit_test_folder() / "clone_test_source";
+    const auto target_dir = unit_test_folder() / "clone_test_target";
+
+    std::filesystem::remove_all(source_dir);
+    std::filesystem::remove_all(target_dir);
+
+    // Create a source repository with a main branch and a side branch
+    Repository source{ source_dir };
+    std::ofstream f(source_dir / "test.txt");
+    f << "clone() test\n";
+    f.close();
+    source.add();
+    source.commit("Add test.txt");
+    const auto main_id = source.head_oid();
+
+    TreeBuilder builder{ source, "HEAD" };
+    builder.insert("side.txt", "side branch\n");
+    builder.commit("refs/heads/side", "Add side.txt");
+    const auto side_id = source.resolve("refs/heads/side");
+
+    const auto source_url = "file://" + std::filesystem::absolute(source_dir).string();
+
+    SECTION("Default options")
+    {
+        std::size_t num_calls = 0;
+        CloneOptions opts;
+        opts.progress = [&num_calls](const FetchStats&) { ++num_calls; return true; };
+
+        auto repo = Repository::clone(source_url, target_dir, opts);
+        REQUIRE(num_calls > 0);
+        REQUIRE(not repo.is_bare());
+        REQUIRE(repo.head_oid() == main_id);
+        REQUIRE(repo.get_current_branch_name() == "main");
+        REQUIRE(repo.resolve("refs/remotes/origin/side") == side_id);
+        REQUIRE(std::filesystem::exists(target_dir / "test.txt"));
+        REQUIRE(repo.list_remote_names() == std::vector<std::string>{ "origin" });
+    }
+
+    SECTION("Bare clone")
+    {
+        CloneOptions opts;
+        opts.bare = true;
+        auto repo = Repository::clone(source_url, target_dir, opts);
+        REQUIRE(repo.is_bare());
+        REQUIRE(repo.head_oid() == main_id);
+        REQUIRE(not std::filesystem::exists(target_dir / "test.txt"));
+    }
+
+    SECTION("No checkout")
+    {
+        CloneOptions opts;
+        opts.no_checkout = true;
+        auto repo = Repository::clone(source_url, target_dir, opts);
+        REQUIRE(repo.head_oid() == main_id);
+        REQUIRE(not std::filesystem::exists(target_dir / "test.txt"));
+    }
+
+    SECTION("Single branch")
+    {
+        CloneOptions opts;
+        opts.branch = "side";
+        opts.single_branch = true;
+        auto repo = Repository::clone(source_url, target_dir, opts);
+        REQUIRE(repo.get_current_branch_name() == "side");
+        REQUIRE(repo.head_oid() == side_id);
+        REQUIRE(std::filesystem::exists(target_dir / "side.txt"));
+        REQUIRE_THROWS_AS(repo.resolve("refs/remotes/origin/main"), git::Error);
+
+        opts.branch.clear();
+        std::filesystem::remove_all(target_dir);
+        REQUIRE_THROWS_AS(Repository::clone(source_url, target_dir, opts), git::Error);
+    }
+
+    SECTION("Local clone hardlinks objects")
+    {
+        CloneOptions opts;
+        opts.bare = true;
+        opts.local = LocalClone::always;
+        auto repo = Repository::clone(source_url, target_dir, opts);
+        REQUIRE(repo.head_oid() == main_id);
+
+        const auto object_dir = target_dir / "objects" / main_id.to_string().substr(0, 2);
+        const auto object_file = object_dir / main_id.to_string().substr(2);
+        REQUIRE(std::filesystem::hard_link_count(object_file) >= 2);
+    }
+
+    SECTION("Shallow clones from the local filesystem are rejected")
+    {
+        // See "Repository: fetch()": shallow transfers need a smart transport.
+        CloneOptions opts;
+        opts.depth = 1;
+        REQUIRE_THROWS_AS(Repository::clone(source_url, target_dir, opts), git::Error);
+
+        std::filesystem::remove_all(target_dir);
+        opts.local = LocalClone::always;
+        REQUIRE_THROWS_AS(Repository::clone(source_dir.string(), target_dir, opts),
+            git::Error);
+
+        opts.local = LocalClone::no_hardlinks;
+        REQUIRE_THROWS_AS(Repository::clone(source_url, target_dir, opts), git::Error);
+    }
+
+    SECTION("Cloning into an existing repository fails")
+    {
+        Repository::clone(source_url, target_dir);
+        REQUIRE_THROWS_AS(Repository::clone(source_url, target_dir), git::Error);
+    }
 }
 
 TEST_CASE("Repository: checkout new branch", "[Repository]")
@@ -0,0 +1,137 @@
+/**
+ * \file   test_StatusList.cc
+ * \date   Created on October 16, 2026
+ * \brief  Test suite for the StatusList class.
+ *
+ * \copyright Copyright 2026 Deutsches Elektronen-Synchrotron (DESY), Hamburg
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation, either version 2.1 of the license, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+
+#include <git2.h>
+#include <gul14/catch.h>
+#include <gul14/gul.h>
+
+#include "libgit4cpp/Error.h"
+#include "libgit4cpp/Repository.h"
+#include "libgit4cpp/StatusList.h"
+#include "test_main.h"
+
+using namespace git;
+using namespace std::literals;
+
+TEST_CASE("StatusList: Constructor", "[StatusList]")
+{
+    REQUIRE_THROWS_AS(StatusList(LibGitStatusList{ nullptr, git_status_list_free }),
+        git::Error);
+}
+
+TEST_CASE("StatusList: Iterate over status_view()", "[StatusList]")
+{
+    const auto reporoot = unit_test_folder() / "StatusList";
+    std::filesystem::remove_all(reporoot);
+    std::filesystem::create_directories(reporoot);
+
+    for (int i = 0; i != 3; ++i)
+        std::ofstream{ reporoot / gul14::cat("file", i, ".txt") } << "Original " << i;
+
+    Repository repo{ reporoot };
+    repo.add();
+    repo.commit("Add files");
+
+    SECTION("Clean repository")
+    {
+        StatusOptions opts;
+        opts.include_unmodified = false;
+        opts.include_ignored = false;
+
+        auto list = repo.status_view(opts);
+        REQUIRE(list.empty());
+        REQUIRE(list.size() == 0);
+        REQUIRE(list.begin() == list.end());
+    }
+
+    SECTION("All files")
+    {
+        std::ofstream{ reporoot / "file1.txt" } << "Changed";
+        std::ofstream{ reporoot / "new.txt" } << "New";
+
+        auto list = repo.status_view();
+        REQUIRE(list.size() == 4);
+
+        RepoState state;
+        for (auto entry : list)
+            state.push_back(entry.to_file_status());
+
+        std::stringstream ss_view;
+        ss_view << state;
+        std::stringstream ss;
+        ss << repo.status();
+        REQUIRE(ss_view.str() == ss.str());
+    }
+
+    SECTION("Stop at first modified file")
+    {
+        std::ofstream{ reporoot / "file2.txt" } << "Changed";
+
+        StatusOptions opts;
+        opts.include_unmodified = false;
+        opts.include_ignored = false;
+
+        auto list = repo.status_view(opts);
+        REQUIRE(list.size() == 1);
+
+        auto it = std::find_if(list.begin(), list.end(),
+            [](const FileStatusView& v) { return v.changes == Change::modified; });
+        REQUIRE(it != list.end());
+        REQUIRE(it->path_name == "file2.txt");
+        REQUIRE(it->old_path_name.empty());
+        REQUIRE(it->handling == Handling::unstaged);
+    }
+
+    SECTION("Undecodable entries are not counted")
+    {
+        // Turn file0.txt into a merge conflict, which has no representation in a view
+        git_index* index = nullptr;
+        REQUIRE(git_repository_index(&index, repo.get_repo()) == 0);
+
+        git_index_entry entry = *git_index_get_bypath(index, "file0.txt", 0);
+        entry.path = "file0.txt";
+        REQUIRE(git_index_conflict_add(index, &entry, &entry, &entry) == 0);
+        REQUIRE(git_index_write(index) == 0);
+        git_index_free(index);
+
+        StatusOptions opts;
+        opts.include_unmodified = false;
+        opts.include_ignored = false;
+
+        auto list = repo.status_view(opts);
+        REQUIRE(git_status_list_entrycount(list.get()) == 1);
+        REQUIRE(list.begin() == list.end());
+        REQUIRE(list.empty());
+        REQUIRE(list.size() == 0);
+
+        std::ofstream{ reporoot / "file1.txt" } << "Changed";
+        auto changed = repo.status_view(opts);
+        REQUIRE(changed.size() == 1);
+        REQUIRE(std::distance(changed.begin(), changed.end()) == 1);
+    }
+}
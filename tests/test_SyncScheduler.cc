@@ -0,0 +1,197 @@
+/**
+ * \file   test_SyncScheduler.cc
+ * \date   Created on October 16, 2026
+ * \brief  Test suite for the SyncScheduler class.
+ *
+ * \copyright Copyright 2026 Deutsches Elektronen-Synchrotron (DESY), Hamburg
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation, either version 2.1 of the license, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <filesystem>
+#include <fstream>
+
+#include <gul14/catch.h>
+#include <gul14/gul.h>
+
+#include "libgit4cpp/Repository.h"
+#include "libgit4cpp/SyncScheduler.h"
+#include "libgit4cpp/wrapper_functions.h"
+#include "test_main.h"
+
+using namespace git;
+using namespace std::literals;
+using gul14::cat;
+
+namespace {
+
+const auto testroot = unit_test_folder() / "SyncScheduler";
+
+/// Return the file URL of a local path.
+std::string file_url(const std::filesystem::path& path)
+{
+    return "file://" + std::filesystem::absolute(path).string();
+}
+
+} // anonymous namespace
+
+TEST_CASE("SyncScheduler: Constructor", "[SyncScheduler]")
+{
+    SyncScheduler scheduler{ 4 };
+    REQUIRE(scheduler.num_threads() == 4);
+    REQUIRE(scheduler.jobs().empty());
+    REQUIRE(scheduler.timeout() == std::chrono::steady_clock::duration::zero());
+
+    SyncScheduler default_scheduler;
+    REQUIRE(default_scheduler.num_threads() >= 1);
+
+    auto report = scheduler.run();
+    REQUIRE(report.results.empty());
+    REQUIRE(report.num_failed == 0);
+}
+
+TEST_CASE("SyncScheduler: run()", "[SyncScheduler]")
+{
+    constexpr int num_repos = 4;
+
+    std::filesystem::remove_all(testroot);
+    const auto remote_path = testroot / "remote";
+    repository_init(remote_path, true);
+
+    // Create several repositories, each of which pushes its main branch to its own
+    // branch on a shared bare remote
+    SyncScheduler push_scheduler{ 3 };
+    for (int i = 0; i != num_repos; ++i)
+    {
+        const auto path = testroot / cat("repo", i);
+        Repository repo{ path };
+        std::ofstream f(path / "file.txt");
+        f << "Repository " << i << "\n";
+        f.close();
+        repo.add();
+        repo.commit(cat("Commit in repository ", i));
+        repo.add_remote("origin", file_url(remote_path));
+
+        push_scheduler.add_job(SyncJob{ path, "origin",
+            { cat("refs/heads/main:refs/heads/repo", i) }, SyncDirection::push });
+    }
+    REQUIRE(push_scheduler.jobs().size() == num_repos);
+
+    auto report = push_scheduler.run();
+    REQUIRE(report.results.size() == num_repos);
+    REQUIRE(report.num_failed == 0);
+    for (const auto& result : report.results)
+    {
+        REQUIRE(result.success);
+        REQUIRE(result.error.empty());
+    }
+
+    // Fetch everything into mirror repositories
+    SyncScheduler fetch_scheduler{ 2 };
+    for (int i = 0; i != num_repos; ++i)
+    {
+        const auto path = testroot / cat("mirror", i);
+        auto mirror = Repository::create(path, InitOptions{ true });
+        mirror.add_remote("origin", file_url(remote_path));
+        fetch_scheduler.add_job(SyncJob{ path });
+    }
+
+    report = fetch_scheduler.run();
+    REQUIRE(report.num_failed == 0);
+    REQUIRE(report.bytes > 0);
+    REQUIRE(report.bytes_per_second() > 0.0);
+    for (const auto& result : report.results)
+        REQUIRE(result.objects > 0);
+
+    for (int i = 0; i != num_repos; ++i)
+    {
+        auto mirror = Repository::open(testroot / cat("mirror", i));
+        for (int j = 0; j != num_repos; ++j)
+        {
+            auto repo = Repository::open(testroot / cat("repo", j));
+            REQUIRE(mirror.resolve(cat("refs/remotes/origin/repo", j))
+                == repo.head_oid());
+        }
+    }
+
+    // A second round has nothing left to transfer
+    report = fetch_scheduler.run();
+    REQUIRE(report.num_failed == 0);
+    for (const auto& result : report.results)
+        REQUIRE(result.objects == 0);
+}
+
+TEST_CASE("SyncScheduler: Errors are reported per job", "[SyncScheduler]")
+{
+    std::filesystem::remove_all(testroot);
+    const auto remote_path = testroot / "remote";
+    const auto mirror_path = testroot / "mirror";
+    repository_init(remote_path, true);
+    {
+        auto mirror = Repository::create(mirror_path, InitOptions{ true });
+        mirror.add_remote("origin", file_url(remote_path));
+    }
+
+    SyncScheduler scheduler{ 2 };
+    scheduler.add_job(SyncJob{ testroot / "does_not_exist" });
+    scheduler.add_job(SyncJob{ mirror_path, "no_such_remote" });
+    scheduler.add_job(SyncJob{ mirror_path });
+
+    auto report = scheduler.run();
+    REQUIRE(report.results.size() == 3);
+    REQUIRE(report.num_failed == 2);
+    REQUIRE(report.num_timed_out == 0);
+    REQUIRE(not report.results[0].success);
+    REQUIRE(not report.results[0].error.empty());
+    REQUIRE(not report.results[1].success);
+    REQUIRE(not report.results[1].error.empty());
+    REQUIRE(report.results[2].success);
+
+    scheduler.clear();
+    REQUIRE(scheduler.jobs().empty());
+}
+
+TEST_CASE("SyncScheduler: Timeout", "[SyncScheduler]")
+{
+    std::filesystem::remove_all(testroot);
+    const auto source_path = testroot / "source";
+    const auto mirror_path = testroot / "mirror";
+    {
+        Repository source{ source_path };
+        std::ofstream f(source_path / "file.txt");
+        f << "Timeout test\n";
+        f.close();
+        source.add();
+        source.commit("Add file.txt");
+
+        auto mirror = Repository::create(mirror_path, InitOptions{ true });
+        mirror.add_remote("origin", file_url(source_path));
+    }
+
+    SyncScheduler scheduler{ 1 };
+    scheduler.set_timeout(1ns);
+    scheduler.add_job(SyncJob{ mirror_path });
+
+    // Fails before any transfer progress is reported, i.e. it is not cancelled
+    scheduler.add_job(SyncJob{ mirror_path, "does_not_exist" });
+
+    auto report = scheduler.run();
+    REQUIRE(report.num_failed == 2);
+    REQUIRE(report.num_timed_out == 1);
+    REQUIRE(report.results[0].timed_out);
+    REQUIRE(not report.results[1].timed_out);
+    REQUIRE(not report.results[1].error.empty());
+}
@@ -0,0 +1,195 @@
+/**
+ * \file   test_TreeBuilder.cc
+ * \date   Created on October 16, 2026
+ * \brief  Test suite for the TreeBuilder class.
+ *
+ * \copyright Copyright 2026 Deutsches Elektronen-Synchrotron (DESY), Hamburg
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation, either version 2.1 of the license, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <filesystem>
+#include <fstream>
+
+#include <git2.h>
+#include <gul14/catch.h>
+#include <gul14/gul.h>
+
+#include "libgit4cpp/Error.h"
+#include "libgit4cpp/Repository.h"
+#include "libgit4cpp/TreeBuilder.h"
+#include "libgit4cpp/wrapper_functions.h"
+#include "test_main.h"
+
+using namespace git;
+using namespace std::literals;
+
+namespace {
+
+const auto reporoot = unit_test_folder() / "TreeBuilder";
+
+/// Return the content of a file at a revision or an empty optional if it does not exist.
+gul14::optional<std::string> read_file(Repository& repo, const std::string& rev,
+    const std::string& path)
+{
+    auto obj = revparse_single(repo.get_repo(), rev + ":" + path);
+    if (not obj || git_object_type(obj.get()) != GIT_OBJECT_BLOB)
+        return {};
+
+    const auto* blob = reinterpret_cast<const git_blob*>(obj.get());
+    return std::string(static_cast<const char*>(git_blob_rawcontent(blob)),
+        static_cast<std::size_t>(git_blob_rawsize(blob)));
+}
+
+} // anonymous namespace
+
+TEST_CASE("TreeBuilder: Constructor", "[TreeBuilder]")
+{
+    std::filesystem::remove_all(reporoot);
+    Repository repo{ reporoot };
+
+    REQUIRE_NOTHROW(TreeBuilder{ repo });
+    REQUIRE_NOTHROW(TreeBuilder{ repo, "HEAD" });
+    REQUIRE_THROWS_AS(TreeBuilder(repo, "refs/heads/does_not_exist"), git::Error);
+}
+
+TEST_CASE("TreeBuilder: Commit to a new branch", "[TreeBuilder]")
+{
+    std::filesystem::remove_all(reporoot);
+    std::filesystem::create_directories(reporoot / "dir");
+    std::ofstream{ reporoot / "file.txt" } << "File";
+    std::ofstream{ reporoot / "dir" / "a.txt" } << "A";
+    std::ofstream{ reporoot / "dir" / "b.txt" } << "B";
+
+    Repository repo{ reporoot };
+    repo.add();
+    repo.commit("Add files");
+
+    TreeBuilder builder{ repo, "HEAD" };
+    builder.insert("dir/sub/new.txt", "New");
+    builder.insert("dir/a.txt", "Changed A");
+    builder.remove("file.txt");
+    builder.remove("does/not/exist.txt");
+    builder.commit("refs/heads/generated", "Generated commit");
+
+    REQUIRE(read_file(repo, "generated", "dir/sub/new.txt") == "New"s);
+    REQUIRE(read_file(repo, "generated", "dir/a.txt") == "Changed A"s);
+    REQUIRE(read_file(repo, "generated", "dir/b.txt") == "B"s);
+    REQUIRE(read_file(repo, "generated", "file.txt").has_value() == false);
+
+    // HEAD, index, and working directory are untouched
+    REQUIRE(repo.get_last_commit_message() == "Add files");
+    REQUIRE(read_file(repo, "HEAD", "file.txt") == "File"s);
+    StatusOptions opts;
+    opts.include_unmodified = false;
+    REQUIRE(repo.status(opts).empty());
+
+    // A second commit on top of the branch removes a whole directory
+    TreeBuilder builder2{ repo, "refs/heads/generated" };
+    builder2.remove("dir/sub");
+    builder2.remove("dir/a.txt");
+    builder2.remove("dir/b.txt");
+    builder2.insert("top.txt", "Top");
+    builder2.commit("refs/heads/generated", "Second generated commit");
+
+    REQUIRE(read_file(repo, "generated", "top.txt") == "Top"s);
+    REQUIRE(read_file(repo, "generated~1", "dir/sub/new.txt") == "New"s);
+    REQUIRE(not revparse_single(repo.get_repo(), "generated:dir"));
+}
+
+TEST_CASE("TreeBuilder: Modifications apply in call order", "[TreeBuilder]")
+{
+    std::filesystem::remove_all(reporoot);
+    std::filesystem::create_directories(reporoot / "dir");
+    std::ofstream{ reporoot / "file.txt" } << "File";
+    std::ofstream{ reporoot / "dir" / "a.txt" } << "A";
+
+    Repository repo{ reporoot };
+    repo.add();
+    repo.commit("Add files");
+
+    SECTION("Removing a directory discards files inserted into it earlier")
+    {
+        TreeBuilder builder{ repo, "HEAD" };
+        builder.insert("dir/x.txt", "X");
+        builder.insert("dir/sub/y.txt", "Y");
+        builder.remove("dir");
+        builder.commit("refs/heads/generated", "Remove dir");
+
+        REQUIRE(not revparse_single(repo.get_repo(), "generated:dir"));
+        REQUIRE(read_file(repo, "generated", "file.txt") == "File"s);
+    }
+
+    SECTION("Inserting into a removed directory recreates it")
+    {
+        TreeBuilder builder{ repo, "HEAD" };
+        builder.remove("dir");
+        builder.insert("dir/x.txt", "X");
+        builder.commit("refs/heads/generated", "Replace dir");
+
+        REQUIRE(read_file(repo, "generated", "dir/x.txt") == "X"s);
+        REQUIRE(not read_file(repo, "generated", "dir/a.txt").has_value());
+    }
+
+    SECTION("A pending file cannot become a directory and vice versa")
+    {
+        TreeBuilder builder{ repo, "HEAD" };
+        builder.insert("new", "File");
+        REQUIRE_THROWS_AS(builder.insert("new/b.txt", "B"), git::Error);
+
+        builder.insert("other/b.txt", "B");
+        REQUIRE_THROWS_AS(builder.insert("other", "File"), git::Error);
+
+        builder.commit("refs/heads/generated", "Conflicts rejected");
+        REQUIRE(read_file(repo, "generated", "new") == "File"s);
+        REQUIRE(read_file(repo, "generated", "other/b.txt") == "B"s);
+    }
+
+    SECTION("A file of the base tree must be removed before it becomes a directory")
+    {
+        TreeBuilder builder{ repo, "HEAD" };
+        builder.insert("file.txt/b.txt", "B");
+        REQUIRE_THROWS_AS(builder.write(), git::Error);
+
+        TreeBuilder builder2{ repo, "HEAD" };
+        builder2.remove("file.txt");
+        builder2.insert("file.txt/b.txt", "B");
+        builder2.commit("refs/heads/generated", "Replace file by directory");
+        REQUIRE(read_file(repo, "generated", "file.txt/b.txt") == "B"s);
+    }
+
+    SECTION("Removing a path below a file has no effect")
+    {
+        TreeBuilder builder{ repo, "HEAD" };
+        builder.remove("file.txt/b.txt");
+        builder.commit("refs/heads/generated", "No-op removal");
+        REQUIRE(read_file(repo, "generated", "file.txt") == "File"s);
+    }
+}
+
+TEST_CASE("TreeBuilder: Invalid paths", "[TreeBuilder]")
+{
+    std::filesystem::remove_all(reporoot);
+    Repository repo{ reporoot };
+    TreeBuilder builder{ repo };
+
+    REQUIRE_THROWS_AS(builder.insert("", "x"), git::Error);
+    REQUIRE_THROWS_AS(builder.insert("/", "x"), git::Error);
+    REQUIRE_THROWS_AS(builder.insert("a//b", "x"), git::Error);
+    REQUIRE_THROWS_AS(builder.insert("a/../b", "x"), git::Error);
+    REQUIRE_THROWS_AS(builder.remove(".git/config"), git::Error);
+    REQUIRE_NOTHROW(builder.insert("/a/b/", "x"));
+}